@@ -3,6 +3,18 @@
 #include <ArmelECS/arlecs.h>
 #include <ArmelECS/arlecs_view.h>
 #include <ArmelECS/arlecs_system.h>
+#include <ArmelECS/arlecs_typed.h>
+#include <ArmelECS/arlecs_snapshot.h>
+#include <ArmelECS/arlecs_mem.h>
+#include <ArmelECS/arlecs_stats.h>
+#include <ArmelECS/arlecs_prefab.h>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 #include <Armel/armel_bench.h>
 
 // --- SETUP ---
@@ -23,6 +35,51 @@ uint32_t C_LIFE = 0;
 uint32_t C_HEAVY = 0;
 uint32_t C_MASS = 0;
 
+// Distance de prefetch des vues (réglée par tune_prefetch)
+static uint32_t g_prefetch = 0;
+
+// --- COMPTEUR dTLB (Linux / perf_event) ---
+
+// Ouvre un compteur de défauts de dTLB en lecture, -1 si indisponible
+static int dtlb_open(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_DTLB
+                | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static void dtlb_start(int fd) {
+#ifdef __linux__
+    if (fd >= 0) { ioctl(fd, PERF_EVENT_IOC_RESET, 0); ioctl(fd, PERF_EVENT_IOC_ENABLE, 0); }
+#else
+    (void)fd;
+#endif
+}
+
+static uint64_t dtlb_stop(int fd) {
+    uint64_t misses = 0;
+#ifdef __linux__
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) misses = 0;
+    }
+#else
+    (void)fd;
+#endif
+    return misses;
+}
+
 // --- FONCTIONS DE BENCHMARK ---
 
 // 1. Test de Création pure
@@ -117,14 +174,46 @@ uint64_t bench_iterate_physics(void) {
     return end - start;
 }
 
+// 3b. Même test que le 3, avec une vue typée (ARL_VIEW_DECLARE)
+// Pas de va_arg, pas de void*, tailles connues à la compilation.
+ARL_VIEW_DECLARE(PhysView, Velocity, Position)
+
+uint64_t bench_iterate_physics_typed(void) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    C_POS = arlecs_component_new(world, Position);
+    C_VEL = arlecs_component_new(world, Velocity);
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        ArlEntity e = arlecs_create_entity(world);
+        arlecs_add_component(world, e, C_POS);
+        Velocity* v = arlecs_add_component(world, e, C_VEL);
+        v->vx = 1.0f; v->vy = 1.0f;
+    }
+
+    uint64_t start = arl_now_ns();
+
+    PhysView view = PhysView_begin(world, C_VEL, C_POS);
+    while (PhysView_next(&view)) {
+        view.c1->x += view.c0->vx;
+        view.c1->y += view.c0->vy;
+    }
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&arena);
+    return end - start;
+}
+
 // 4. Test "Fragmentation" (Sparse Set Power)
 // On a 1M d'entités avec POS.
 // Seulement 1 sur 10 (100k) a une VELOCITY.
 // Le test : Est-ce que la boucle saute efficacement les 900k inutiles ?
-uint64_t bench_iterate_sparse(void) {
+static uint64_t iterate_sparse_run(uint32_t mem_flags, int dtlb_fd, uint64_t* dtlb_misses, uint32_t* mem_done) {
     Armel arena;
     arl_new(&arena, MEMORY_SIZE);
-    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    ArlEcsWorld* world = arlecs_world_create_ex(&arena, ENTITY_COUNT, mem_flags, -1);
     
     C_POS = arlecs_component_new(world, Position);
     C_VEL = arlecs_component_new(world, Velocity);
@@ -139,12 +228,14 @@ uint64_t bench_iterate_sparse(void) {
         }
     }
 
+    dtlb_start(dtlb_fd);
     uint64_t start = arl_now_ns();
 
     // Astuce ArlECS : Mettre le composant le plus rare (VEL) en PREMIER
     // Comme ça, on boucle sur 100k éléments, et on check POS (qui est présent).
     // Si on faisait l'inverse, on bouclerait sur 1M pour rien.
     ArlView view = arlecs_view(world, 2, C_VEL, C_POS);
+    arlecs_view_set_prefetch(&view, g_prefetch);
     
     int count = 0;
     while (arlecs_view_next(&view)) {
@@ -155,13 +246,395 @@ uint64_t bench_iterate_sparse(void) {
     }
 
     uint64_t end = arl_now_ns();
+    uint64_t misses = dtlb_stop(dtlb_fd);
 
+    if (dtlb_misses) *dtlb_misses = misses;
+    if (mem_done) *mem_done = world->pools[C_POS]->mem_flags;
     if (count != ENTITY_COUNT / 10) printf("⚠️ Error in sparse count\n");
 
     arl_free(&arena);
     return end - start;
 }
 
+uint64_t bench_iterate_sparse(void) {
+    return iterate_sparse_run(ARLECS_MEM_DEFAULT, -1, NULL, NULL);
+}
+
+// 4b. Même test, pools en huge pages (moins de défauts de TLB sur le sparse)
+uint64_t bench_iterate_sparse_huge(void) {
+    return iterate_sparse_run(ARLECS_MEM_HUGEPAGES, -1, NULL, NULL);
+}
+
+// Compare les défauts de dTLB avec et sans huge pages (une seule passe chacun)
+static void report_dtlb(void) {
+    int fd = dtlb_open();
+    if (fd < 0) {
+        printf("   dTLB misses : n/a (perf_event unavailable)\n");
+        return;
+    }
+
+    uint64_t small_misses = 0, huge_misses = 0;
+    uint32_t huge_done = 0;
+    iterate_sparse_run(ARLECS_MEM_DEFAULT, fd, &small_misses, NULL);
+    iterate_sparse_run(ARLECS_MEM_HUGEPAGES, fd, &huge_misses, &huge_done);
+
+    printf("   dTLB misses : %llu (4 KB pages) vs %llu (huge pages %s)\n",
+        (unsigned long long)small_misses, (unsigned long long)huge_misses,
+        (huge_done & ARLECS_MEM_HUGEPAGES) ? "accepted" : "refused");
+#ifdef __linux__
+    close(fd);
+#endif
+}
+
+
+// 4c. Test "Intersection" : 10% Mass ET 50% Life, répartis au hasard
+// Vue classique (parcours du dense de Mass + sondes) vs ET des bitsets.
+static uint64_t intersect_run(bool bitset) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+
+    ArlPoolDesc mass_desc = { sizeof(Mass), bitset ? ARLECS_POOL_BITSET : ARLECS_POOL_DEFAULT, 0.0f, 0, 0 };
+    ArlPoolDesc life_desc = { sizeof(Life), bitset ? ARLECS_POOL_BITSET : ARLECS_POOL_DEFAULT, 0.0f, 0, 0 };
+    C_MASS = arlecs_register_component_desc(world, &mass_desc);
+    C_LIFE = arlecs_register_component_desc(world, &life_desc);
+
+    uint32_t seed = 12345;
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        ArlEntity e = arlecs_create_entity(world);
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed >> 8) % 10 == 0) ((Mass*)arlecs_add_component(world, e, C_MASS))->density = 1.0f;
+        if ((seed >> 20) & 1) ((Life*)arlecs_add_component(world, e, C_LIFE))->life = 1.0f;
+    }
+
+    uint64_t start = arl_now_ns();
+
+    float sum = 0.0f;
+    if (bitset) {
+        ArlBitsetView view = arlecs_bitset_view(world, 2, C_MASS, C_LIFE);
+        while (arlecs_bitset_view_next(&view)) {
+            sum += ((Mass*)view.components[0])->density * ((Life*)view.components[1])->life;
+        }
+    } else {
+        ArlView view = arlecs_view(world, 2, C_MASS, C_LIFE);
+        while (arlecs_view_next(&view)) {
+            sum += ((Mass*)view.components[0])->density * ((Life*)view.components[1])->life;
+        }
+    }
+
+    uint64_t end = arl_now_ns();
+
+    if (sum < 40000.0f || sum > 60000.0f) printf("⚠️ Error in intersection count\n");
+
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_intersect_view(void) {
+    return intersect_run(false);
+}
+
+uint64_t bench_intersect_bitset(void) {
+    return intersect_run(true);
+}
+
+
+// 5. Test "Rollback" : sauvegarde + restauration d'un monde complet
+// 1M Pos + Vel, ce que ferait un netcode à chaque frame de resimulation.
+uint64_t bench_snapshot_restore(void) {
+    Armel arena, saves;
+    arl_new(&arena, MEMORY_SIZE);
+    arl_new(&saves, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    C_POS = arlecs_component_new(world, Position);
+    C_VEL = arlecs_component_new(world, Velocity);
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        ArlEntity e = arlecs_create_entity(world);
+        arlecs_add_component(world, e, C_POS);
+        arlecs_add_component(world, e, C_VEL);
+    }
+
+    uint64_t start = arl_now_ns();
+
+    ArlEcsWorld* snap = arlecs_world_clone_into(world, &saves);
+    arlecs_world_restore(world, snap);
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&saves);
+    arl_free(&arena);
+    return end - start;
+}
+
+
+// 6. Test "Churn" : gros composants (512 octets), 10% retirés puis rajoutés
+// Swap & pop copie un élément par retrait, le mode stable laisse une tombe.
+typedef struct { float m[128]; } BigComponent;
+
+static uint64_t churn_run(uint32_t flags) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT / 4);
+
+    ArlPoolDesc desc = { sizeof(BigComponent), flags, 0.0f, 0, 0 };
+    uint32_t c_big = arlecs_register_component_desc(world, &desc);
+
+    for (int i = 0; i < ENTITY_COUNT / 4; i++) {
+        BigComponent* big = (BigComponent*)arlecs_add_component(world, arlecs_create_entity(world), c_big);
+        memset(big, 0, sizeof(*big));
+    }
+
+    uint64_t start = arl_now_ns();
+
+    for (int round = 0; round < 4; round++) {
+        for (ArlEntity e = round; e < (ArlEntity)ENTITY_COUNT / 4; e += 10) arlecs_remove_component(world, e, c_big);
+        for (ArlEntity e = round; e < (ArlEntity)ENTITY_COUNT / 4; e += 10) arlecs_add_component(world, e, c_big);
+    }
+    arlecs_world_compact(world);
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_churn_swap(void) {
+    return churn_run(ARLECS_POOL_DEFAULT);
+}
+
+uint64_t bench_churn_stable(void) {
+    return churn_run(ARLECS_POOL_STABLE);
+}
+
+
+// 7. Test "Cull" : 30% des Pos (1M) expirent d'un coup
+// Une boucle de retraits (swap & pop) contre une seule passe de compactage.
+static bool pos_expired(ArlEntity entity, void* data, void* ctx) {
+    (void)data; (void)ctx;
+    return entity % 10 < 3;
+}
+
+static uint64_t cull_run(bool bulk) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    uint32_t c_pos = arlecs_component_new(world, Position);
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        Position* p = (Position*)arlecs_add_component(world, arlecs_create_entity(world), c_pos);
+        p->x = p->y = (float)i;
+    }
+
+    uint64_t start = arl_now_ns();
+
+    if (bulk) {
+        arlecs_pool_remove_if(world->pools[c_pos], pos_expired, NULL);
+    } else {
+        for (ArlEntity e = 0; e < (ArlEntity)ENTITY_COUNT; e++) {
+            if (pos_expired(e, NULL, NULL)) arlecs_remove_component(world, e, c_pos);
+        }
+    }
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_cull_loop(void) {
+    return cull_run(false);
+}
+
+uint64_t bench_cull_remove_if(void) {
+    return cull_run(true);
+}
+
+
+// 8. Test "Particules" : 100k entités d'une frame, 10 frames
+// Entités normales retirées une à une, contre entités transitoires expirées d'un coup.
+#define PARTICLE_COUNT 100000
+
+static uint64_t particles_run(bool transient) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    if (transient) arlecs_world_reserve_transients(world, PARTICLE_COUNT);
+    uint32_t c_pos = arlecs_component_new(world, Position);
+    uint32_t c_vel = arlecs_component_new(world, Velocity);
+
+    uint64_t start = arl_now_ns();
+
+    for (int frame = 0; frame < 10; frame++) {
+        ArlEntity first = 0;
+        for (int i = 0; i < PARTICLE_COUNT; i++) {
+            ArlEntity e = transient ? arlecs_create_transient(world) : arlecs_create_entity(world);
+            if (i == 0) first = e;
+            ((Position*)arlecs_add_component(world, e, c_pos))->x = (float)i;
+            ((Velocity*)arlecs_add_component(world, e, c_vel))->vx = 1.0f;
+        }
+
+        if (transient) {
+            arlecs_expire_transients(world);
+        } else {
+            for (ArlEntity e = first; e < first + PARTICLE_COUNT; e++) {
+                arlecs_remove_component(world, e, c_pos);
+                arlecs_remove_component(world, e, c_vel);
+            }
+        }
+    }
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_particles_remove(void) {
+    return particles_run(false);
+}
+
+uint64_t bench_particles_transient(void) {
+    return particles_run(true);
+}
+
+
+// 9. Test "Spawner" : 1M astéroïdes (Position, Velocity, Life, Mass) identiques
+// Ajouts individuels + écritures de champs, contre instanciation d'un prefab.
+static uint64_t spawn_run(bool prefab) {
+    Armel arena;
+    arl_new(&arena, MEMORY_SIZE);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    uint32_t c_pos  = arlecs_component_new(world, Position);
+    uint32_t c_vel  = arlecs_component_new(world, Velocity);
+    uint32_t c_life = arlecs_component_new(world, Life);
+    uint32_t c_mass = arlecs_component_new(world, Mass);
+
+    Armel assets;
+    arl_new(&assets, 4096);
+    ArlPrefab asteroid;
+    arlecs_prefab_init(&asteroid, &assets);
+    arlecs_prefab_add(world, &asteroid, c_pos);
+    ((Velocity*)arlecs_prefab_add(world, &asteroid, c_vel))->vx = 1.0f;
+    *(Life*)arlecs_prefab_add(world, &asteroid, c_life) = (Life){ 10.0f, 10.0f };
+    ((Mass*)arlecs_prefab_add(world, &asteroid, c_mass))->density = 3.0f;
+
+    uint64_t start = arl_now_ns();
+
+    if (prefab) {
+        arlecs_instantiate(world, &asteroid, ENTITY_COUNT, NULL);
+    } else {
+        for (int i = 0; i < ENTITY_COUNT; i++) {
+            ArlEntity e = arlecs_create_entity(world);
+            Position* p = (Position*)arlecs_add_component(world, e, c_pos);
+            p->x = p->y = 0.0f;
+            ((Velocity*)arlecs_add_component(world, e, c_vel))->vx = 1.0f;
+            *(Life*)arlecs_add_component(world, e, c_life) = (Life){ 10.0f, 10.0f };
+            ((Mass*)arlecs_add_component(world, e, c_mass))->density = 3.0f;
+        }
+    }
+
+    uint64_t end = arl_now_ns();
+
+    arl_free(&assets);
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_spawn_add(void) {
+    return spawn_run(false);
+}
+
+uint64_t bench_spawn_prefab(void) {
+    return spawn_run(true);
+}
+
+
+// 10. Test "Serveur au repos" : 64 systèmes lisent 10k Pos qui ne changent pas, 100 frames
+// Systèmes toujours appelés, contre systèmes réactifs sautés tant que leurs entrées ne bougent pas.
+#define IDLE_SYSTEMS 64
+#define IDLE_ENTITIES 10000
+
+static void sys_idle_scan(ArlEcsWorld* world, void* ctx) {
+    float* sink = (float*)ctx;
+    ArlView view = arlecs_view(world, 1, C_POS);
+    while (arlecs_view_next(&view)) *sink += ((Position*)view.components[0])->x;
+}
+
+static uint64_t idle_run(bool reactive) {
+    Armel arena;
+    arl_new(&arena, 16 * 1024 * 1024);
+    ArlEcsWorld* world = arlecs_world_create(&arena, IDLE_ENTITIES);
+    C_POS = arlecs_component_new(world, Position);
+    for (int i = 0; i < IDLE_ENTITIES; i++) arlecs_add_component(world, arlecs_create_entity(world), C_POS);
+
+    static char names[IDLE_SYSTEMS][16];
+    ArlSystemManager mgr;
+    arlecs_sys_init(&mgr);
+    for (int i = 0; i < IDLE_SYSTEMS; i++) {
+        snprintf(names[i], sizeof(names[i]), "Idle%d", i);
+        arlecs_sys_register(&mgr, names[i], ARL_PHASE_UPDATE, sys_idle_scan);
+        if (reactive) {
+            arlecs_sys_require(&mgr, names[i], C_POS);
+            arlecs_sys_set_reactive(&mgr, names[i], true);
+        }
+    }
+
+    float sink = 0.0f;
+    uint64_t start = arl_now_ns();
+
+    for (int frame = 0; frame < 100; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, &sink);
+
+    uint64_t end = arl_now_ns();
+
+    if (sink < 0.0f) printf("%f\n", sink);
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_idle_always(void) {
+    return idle_run(false);
+}
+
+uint64_t bench_idle_reactive(void) {
+    return idle_run(true);
+}
+
+
+// 11. Test "Composant rare" : 64 porteurs parmi 1M entités, 1M lookups (presque tous ratés)
+// Sparse de 1M entrées (4 Mo) contre table de hachage de 128 cases (1 Ko).
+#define RARE_HOLDERS 64
+
+static uint64_t rare_run(bool hashed) {
+    Armel arena;
+    arl_new(&arena, 32 * 1024 * 1024);
+    ArlEcsWorld* world = arlecs_world_create(&arena, ENTITY_COUNT);
+    uint32_t c_rare = hashed ? arlecs_register_component_hashed(world, sizeof(Mass), RARE_HOLDERS)
+                             : arlecs_register_component(world, sizeof(Mass));
+
+    for (int i = 0; i < ENTITY_COUNT; i++) arlecs_create_entity(world);
+    for (int i = 0; i < RARE_HOLDERS; i++) arlecs_add_component(world, (ArlEntity)(i * (ENTITY_COUNT / RARE_HOLDERS)), c_rare);
+
+    uint32_t found = 0;
+    uint64_t start = arl_now_ns();
+
+    for (int i = 0; i < ENTITY_COUNT; i++) found += arlecs_get_component(world, (ArlEntity)i, c_rare) != NULL;
+
+    uint64_t end = arl_now_ns();
+
+    if (found != RARE_HOLDERS) printf("rare: %u\n", found);
+    arl_free(&arena);
+    return end - start;
+}
+
+uint64_t bench_rare_sparse(void) {
+    return rare_run(false);
+}
+
+uint64_t bench_rare_hashed(void) {
+    return rare_run(true);
+}
+
 
 // --- BENCHMARK : STELLAR COLLAPSE // 
 
@@ -177,6 +650,7 @@ static inline void sys_gravity(ArlEcsWorld* world, void* ctx) {
     // Vue sur 3 composants : Mass, Vel, Pos
     // On met MASS en premier car c'est le plus rare (100k vs 1M) -> Optimisation cruciale
     ArlView v = arlecs_view(world, 3, C_MASS, C_VEL, C_POS);
+    arlecs_view_set_prefetch(&v, g_prefetch);
 
     while (arlecs_view_next(&v)) {
         Velocity* vel = (Velocity*)v.components[1];
@@ -299,6 +773,36 @@ uint64_t run_game_loop_bench(void) {
 // --- ENDOF BENCHMARK : STELLAR COLLAPSE // 
 
 
+// --- AUTO-TUNING DU PREFETCH ---
+
+// Essaie plusieurs distances et garde la plus rapide (meilleur temps sur quelques passes)
+static uint32_t tune_prefetch(const char* label, arl_bench_func fn) {
+    static const uint32_t candidates[] = { 0, 4, 8, 16, 32, 64 };
+    const int passes = 3;
+
+    uint32_t best = 0;
+    uint64_t best_ns = UINT64_MAX;
+
+    printf("   Tuning prefetch for %s:\n", label);
+    for (size_t c = 0; c < sizeof(candidates) / sizeof(candidates[0]); c++) {
+        g_prefetch = candidates[c];
+
+        uint64_t ns = UINT64_MAX;
+        for (int p = 0; p < passes; p++) {
+            uint64_t t = fn();
+            if (t < ns) ns = t;
+        }
+
+        printf("     distance %2u : %.2f ms\n", g_prefetch, ns / 1e6);
+        if (ns < best_ns) { best_ns = ns; best = g_prefetch; }
+    }
+
+    printf("   -> best distance : %u\n", best);
+    g_prefetch = best;
+    return best;
+}
+
+
 // --- MAIN ---
 
 int main() {
@@ -313,7 +817,29 @@ int main() {
     arl_bench_avg("Creation (1M entities + Comp)", bench_creation);
     arl_bench_avg("Iterate Single (1M Pos)", bench_iterate_single);
     arl_bench_avg("Iterate Dual (1M Pos + Vel)", bench_iterate_physics);
+    arl_bench_avg("Iterate Dual Typed (1M Pos + Vel)", bench_iterate_physics_typed);
     arl_bench_avg("Iterate Sparse (100k active / 1M)", bench_iterate_sparse);
+    arl_bench_avg("Iterate Sparse Huge Pages (100k / 1M)", bench_iterate_sparse_huge);
+    report_dtlb();
+    arl_bench_avg("Intersect 10% x 50% (view)", bench_intersect_view);
+    arl_bench_avg("Intersect 10% x 50% (bitset view)", bench_intersect_bitset);
+
+    tune_prefetch("Iterate Sparse", bench_iterate_sparse);
+    arl_bench_avg("Iterate Sparse (tuned prefetch)", bench_iterate_sparse);
+    g_prefetch = 0;
+    arl_bench_avg("Snapshot + Restore (1M Pos + Vel)", bench_snapshot_restore);
+    arl_bench_avg("Churn 512B (swap & pop)", bench_churn_swap);
+    arl_bench_avg("Churn 512B (stable pool)", bench_churn_stable);
+    arl_bench_avg("Cull 30% of 1M Pos (remove loop)", bench_cull_loop);
+    arl_bench_avg("Cull 30% of 1M Pos (remove_if)", bench_cull_remove_if);
+    arl_bench_avg("Particles 100k x 10 frames (remove)", bench_particles_remove);
+    arl_bench_avg("Particles 100k x 10 frames (transient)", bench_particles_transient);
+    arl_bench_avg("Spawn 1M x 4 comps (add_component)", bench_spawn_add);
+    arl_bench_avg("Spawn 1M x 4 comps (prefab)", bench_spawn_prefab);
+    arl_bench_avg("Idle 64 systems x 100 frames (always)", bench_idle_always);
+    arl_bench_avg("Idle 64 systems x 100 frames (reactive)", bench_idle_reactive);
+    arl_bench_avg("Rare 64 / 1M lookups (sparse)", bench_rare_sparse);
+    arl_bench_avg("Rare 64 / 1M lookups (hashed)", bench_rare_hashed);
 
 	printf("\n==========================================\n");
     printf(" 🌌 GALAXY COLLAPSE : FULL SYSTEM TEST 🌌 \n");
@@ -322,6 +848,10 @@ int main() {
 
     arl_bench_avg("Full Game Loop (3 Systems)", run_game_loop_bench);
 
+    tune_prefetch("Gravity (Full Game Loop)", run_game_loop_bench);
+    arl_bench_avg("Full Game Loop (tuned prefetch)", run_game_loop_bench);
+    g_prefetch = 0;
+
     printf("\n✅ Benchmarks finished.\n");
     return 0;
 }
\ No newline at end of file
@@ -8,9 +8,15 @@
 #define ARLECS_H
 
 #include <ArmelECS/arlecs_pool.h>
+#include <ArmelECS/arlecs_mask.h> // ARLECS_MAX_COMPONENT_TYPES (configurable) + ArlComponentMask
 
-/** Maximum number of distinct component types (IDs) allowed in the world. */
-#define ARLECS_MAX_COMPONENT_TYPES 32
+/**
+ * Maximum number of world resources (singletons).
+ * Kept at 64 so that a set of resources fits in one uint64_t (system access declarations).
+ */
+#define ARLECS_MAX_RESOURCES 64
+
+struct ArlSlice; // Time slicing state of the running system (see arlecs_system.h)
 
 /**
  * @brief The main container for the ECS.
@@ -31,6 +37,25 @@ typedef struct {
 
 	uint32_t component_counter;
 
+	void* resources[ARLECS_MAX_RESOURCES]; ///< World singletons (clock, input, config...), one slot each.
+	uint32_t resource_counter;
+
+	uint32_t mem_flags;    ///< ARLECS_MEM_* hints requested for every pool (see arlecs_world_create_ex).
+	int numa_node;         ///< NUMA node used with ARLECS_MEM_NUMA.
+
+	// Scratch memory, published by the system manager while a phase is running
+	Armel* frame_scratch;  ///< Frame scratch arena, rewound after each phase (NULL outside of a phase).
+	Armel* worker_scratch; ///< Per-worker scratch arenas (worker_count entries).
+	uint32_t worker_count; ///< Number of worker scratch arenas available.
+	struct ArlSlice* slice; ///< Budget of the running system if it is time-sliced, NULL otherwise.
+
+	size_t footprint;      ///< Bytes covered by a snapshot (see arlecs_world_clone_into), 0 for a live world.
+	size_t max_align;      ///< Largest data alignment of its pools, kept by snapshots.
+
+	// Transient entities (see arlecs_world_reserve_transients)
+	uint32_t transient_base;    ///< First transient ID, max_entities if none are reserved.
+	uint32_t transient_counter; ///< The next available transient ID.
+
 } ArlEcsWorld;
 
 
@@ -43,12 +68,67 @@ typedef struct {
  */
 ArlEcsWorld* arlecs_world_create(Armel* armel, uint32_t max_entities);
 
+/**
+ * @brief Creates a new ECS World whose pools request huge pages and/or NUMA binding.
+ * The result is best effort, check ArlPool::mem_flags or arlecs_world_stats().
+ * @param armel Pointer to an initialized Armel arena.
+ * @param mem_flags ARLECS_MEM_HUGEPAGES and/or ARLECS_MEM_NUMA (see arlecs_mem.h).
+ * @param numa_node Node for ARLECS_MEM_NUMA (ignored otherwise).
+ * @return A pointer to the created World.
+ */
+ArlEcsWorld* arlecs_world_create_ex(Armel* armel, uint32_t max_entities, uint32_t mem_flags, int numa_node);
+
 /**
  * @brief Creates a new entity.
  * @return A unique Entity ID (uint32_t).
  */
 ArlEntity arlecs_create_entity(ArlEcsWorld* world);
 
+/**
+ * @brief Thread-safe version of arlecs_create_entity() (lock-free).
+ * @return A unique Entity ID, or ARL_NULL_ENTITY if the world is full.
+ */
+ArlEntity arlecs_create_entity_atomic(ArlEcsWorld* world);
+
+/**
+ * @brief Reserves a range of entity IDs at once (thread-safe).
+ * A worker reserves a batch and hands IDs out locally, without touching the shared counter again.
+ * The counter is only published if the whole range fits: a full world is never overrun.
+ * @param count Number of IDs to reserve.
+ * @return The first ID of the range [first, first + count), or ARL_NULL_ENTITY if it does not fit.
+ */
+ArlEntity arlecs_reserve_entities(ArlEcsWorld* world, uint32_t count);
+
+/**
+ * @brief Reserves the top 'count' entity IDs for transient entities: particles,
+ * hit markers, one-frame events... They live until arlecs_expire_transients(),
+ * which drops all of them at once in O(component types).
+ * Their components are stored at the end of each pool, so views see them like
+ * any other component. Call before creating count IDs below max_entities.
+ */
+void arlecs_world_reserve_transients(ArlEcsWorld* world, uint32_t count);
+
+/**
+ * @brief Creates a transient entity (see arlecs_world_reserve_transients).
+ * Its components are added with the usual functions.
+ * @return A transient Entity ID, reused after the next expiry.
+ */
+ArlEntity arlecs_create_transient(ArlEcsWorld* world);
+
+/**
+ * @brief Drops every transient entity and its components (typically at frame end).
+ * No per-entity work: each pool cuts its transient tail, the IDs restart from the base.
+ * @warning Pointers to transient components become invalid.
+ */
+void arlecs_expire_transients(ArlEcsWorld* world);
+
+/**
+ * @brief Checks if an entity ID belongs to the transient range.
+ */
+static inline bool arlecs_is_transient(const ArlEcsWorld* world, ArlEntity entity) {
+	return entity >= world->transient_base;
+}
+
 /**
  * @brief Registers a component type in the world.
  * Use the macro arlecs_component_new() instead for type safety.
@@ -56,6 +136,33 @@ ArlEntity arlecs_create_entity(ArlEcsWorld* world);
  */
 uint32_t arlecs_register_component(ArlEcsWorld* world, size_t size);
 
+/**
+ * @brief Registers a component type whose elements must start on 'align' bytes
+ * (e.g. 32 for aligned AVX loads). The stride is padded to the alignment.
+ * Use the macro arlecs_component_new_aligned() instead for type safety.
+ * @param size The size of the struct in bytes.
+ * @param align Alignment in bytes (power of two).
+ */
+uint32_t arlecs_register_component_aligned(ArlEcsWorld* world, size_t size, size_t align);
+
+/**
+ * @brief Registers a rare component type (held by a handful of entities) in a
+ * hashed pool (ARLECS_POOL_HASHED): memory is proportional to max_count instead
+ * of max_entities. Views and arlecs_get_component() work the same.
+ * Use the macro arlecs_component_new_hashed() instead for type safety.
+ * @param size The size of the struct in bytes.
+ * @param max_count Maximum number of entities holding it (0 = ARLECS_POOL_HASH_CAPACITY).
+ */
+uint32_t arlecs_register_component_hashed(ArlEcsWorld* world, size_t size, uint32_t max_count);
+
+/**
+ * @brief Registers a component type with an explicit storage mode (see ArlPoolDesc).
+ * Usage :
+ * ArlPoolDesc desc = { sizeof(Mesh), ARLECS_POOL_STABLE, 0.0f, 0, 0 };
+ * COMP_MESH = arlecs_register_component_desc(world, &desc);
+ */
+uint32_t arlecs_register_component_desc(ArlEcsWorld* world, const ArlPoolDesc* desc);
+
 /**
  * @brief Helper macro to register a component safely.
  * Usage :
@@ -66,12 +173,69 @@ uint32_t arlecs_register_component(ArlEcsWorld* world, size_t size);
 #define arlecs_component_new(WORLD,TYPE) \
 	arlecs_register_component(WORLD, sizeof(TYPE));
 
+/**
+ * @brief Registers a component with the alignment of its type (_Alignof).
+ * Usage :
+ * typedef struct { _Alignas(32) float v[8]; } Lanes;
+ * COMP_LANES = arlecs_component_new_aligned(world, Lanes);
+ */
+#define arlecs_component_new_aligned(WORLD,TYPE) \
+	arlecs_register_component_aligned(WORLD, sizeof(TYPE), _Alignof(TYPE));
+
+/**
+ * @brief Registers a rare component in a hashed pool.
+ * Usage :
+ * COMP_BOSS = arlecs_component_new_hashed(world, Boss, 8);
+ */
+#define arlecs_component_new_hashed(WORLD,TYPE,MAX_COUNT) \
+	arlecs_register_component_hashed(WORLD, sizeof(TYPE), MAX_COUNT);
+
+/**
+ * @brief Registers a world resource: a single zero-initialized instance of a struct,
+ * allocated in the world arena and reached through a direct pointer.
+ * Use the macro arlecs_resource_new() instead for type safety.
+ * @param size The size of the struct in bytes.
+ * @return The resource ID.
+ */
+uint32_t arlecs_register_resource(ArlEcsWorld* world, size_t size);
+
+/**
+ * @brief Helper macro to register a resource.
+ * Usage :
+ * RES_CLOCK = arlecs_resource_new(world, GameClock);
+ * GameClock* clock = arlecs_resource_get(world, RES_CLOCK, GameClock);
+ */
+#define arlecs_resource_new(WORLD,TYPE) \
+	arlecs_register_resource(WORLD, sizeof(TYPE))
+
+/**
+ * @brief Returns a resource (one indexed load, no entity lookup).
+ * @return A pointer to the resource data.
+ */
+static inline void* arlecs_resource(ArlEcsWorld* world, uint32_t resource_id) {
+	assert(resource_id < world->resource_counter && "ArlECS Error: Unknown resource");
+	return world->resources[resource_id];
+}
+
+/**
+ * @brief Typed version of arlecs_resource().
+ */
+#define arlecs_resource_get(WORLD,ID,TYPE) \
+	((TYPE*)arlecs_resource(WORLD, ID))
+
 /**
  * @brief Adds a component to an entity.
  * @return A pointer to the newly allocated component memory (zero-initialized or undefined).
  */
 void* arlecs_add_component(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id);
 
+/**
+ * @brief Thread-safe version of arlecs_add_component() (see arlecs_pool_add_concurrent()).
+ * The entity must not own the component yet, and must be added by a single thread.
+ * @return A pointer to the component memory, or NULL if the pool is full.
+ */
+void* arlecs_add_component_concurrent(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id);
+
 /**
  * @brief Retrieves a component for a given entity.
  * @return A pointer to the component data, or NULL if the entity does not have it.
@@ -83,6 +247,64 @@ void* arlecs_get_component(ArlEcsWorld* world, ArlEntity entity, uint32_t compon
  */
 void arlecs_remove_component(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id);
 
+/**
+ * @brief Removes a component from many entities with a single compaction pass
+ * (see arlecs_pool_remove_batch). The survivors keep their order.
+ * @return The number of components removed.
+ */
+uint32_t arlecs_remove_components_batch(ArlEcsWorld* world, uint32_t component_id, const ArlEntity* entities, uint32_t count);
+
+/**
+ * @brief Compacts every stable pool whose tombstone ratio passed its threshold.
+ * Call it where no component pointer is held, typically at the end of a frame.
+ * @return Number of pools compacted.
+ */
+uint32_t arlecs_world_compact(ArlEcsWorld* world);
+
+/**
+ * @brief Moves the internal pointers of a world whose memory was copied elsewhere.
+ * Every pointer inside [lo, hi) (pools and their arrays) is shifted by delta bytes.
+ * Costs O(component types), never O(entities).
+ * @param world The world (already at its new location).
+ * @param lo Start of the old memory range.
+ * @param hi End of the old memory range.
+ * @param delta New address - old address.
+ */
+void arlecs_world_relocate(ArlEcsWorld* world, uintptr_t lo, uintptr_t hi, intptr_t delta);
+
+/**
+ * @brief Builds the set of components owned by an entity.
+ * @param out Receives one bit per component the entity has.
+ */
+void arlecs_entity_mask(ArlEcsWorld* world, ArlEntity entity, ArlComponentMask* out);
+
+/**
+ * @brief Checks if an entity owns every component of the mask.
+ */
+bool arlecs_has_components(ArlEcsWorld* world, ArlEntity entity, const ArlComponentMask* mask);
+
+/**
+ * @brief Returns the frame scratch arena bound by the system manager.
+ * Memory allocated here is released automatically at the end of the current phase,
+ * use it for temporary buffers (sort keys, neighbor lists...) inside a system.
+ * @return The frame scratch arena.
+ */
+static inline Armel* arlecs_frame_scratch(ArlEcsWorld* world) {
+	assert(world->frame_scratch != NULL && "ArlECS Error: No scratch arena bound (see arlecs_sys_init_scratch)");
+	return world->frame_scratch;
+}
+
+/**
+ * @brief Returns the scratch arena reserved for a given worker thread.
+ * Each worker must only allocate in its own arena. Released at the end of the current phase.
+ * @param worker Index of the worker (0 .. worker_count - 1).
+ * @return The worker scratch arena.
+ */
+static inline Armel* arlecs_worker_scratch(ArlEcsWorld* world, uint32_t worker) {
+	assert(worker < world->worker_count && "ArlECS Error: Worker scratch index out of bounds");
+	return &world->worker_scratch[worker];
+}
+
 // Include Views at the end to ensure World definition is known
 #include <ArmelECS/arlecs_view.h>
 
@@ -0,0 +1,68 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_ATOMIC_H
+#define ARLECS_ATOMIC_H
+
+#include <stdint.h>
+
+/*
+ * Minimal atomic operations on plain integers (C99 has no <stdatomic.h>).
+ * GCC / Clang builtins, Interlocked intrinsics on MSVC.
+ */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+
+	#define ARL_ATOMIC_FETCH_ADD_U32(ptr, v) \
+		((uint32_t)_InterlockedExchangeAdd((volatile long*)(ptr), (long)(v)))
+	#define ARL_ATOMIC_FETCH_ADD_U64(ptr, v) \
+		((uint64_t)_InterlockedExchangeAdd64((volatile long long*)(ptr), (long long)(v)))
+	#define ARL_ATOMIC_CAS_U32(ptr, expected, desired) \
+		(_InterlockedCompareExchange((volatile long*)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+	#define ARL_ATOMIC_LOAD_U32(ptr) \
+		((uint32_t)_InterlockedOr((volatile long*)(ptr), 0))
+	#define ARL_ATOMIC_STORE_U32(ptr, v) \
+		((void)_InterlockedExchange((volatile long*)(ptr), (long)(v)))
+	#define ARL_ATOMIC_STORE_U16(ptr, v) \
+		((void)_InterlockedExchange16((volatile short*)(ptr), (short)(v)))
+	#define ARL_ATOMIC_OR_U64(ptr, v) \
+		((void)_InterlockedOr64((volatile long long*)(ptr), (long long)(v)))
+	#define ARL_ATOMIC_LOAD_U64(ptr) \
+		((uint64_t)_InterlockedOr64((volatile long long*)(ptr), 0))
+	#define ARL_ATOMIC_STORE_U64(ptr, v) \
+		((void)_InterlockedExchange64((volatile long long*)(ptr), (long long)(v)))
+	// x86 / x64 : le matériel ordonne déjà, seul le compilateur doit être retenu
+	#define ARL_ATOMIC_FENCE_ACQUIRE() _ReadWriteBarrier()
+	#define ARL_ATOMIC_FENCE_RELEASE() _ReadWriteBarrier()
+#else
+	/** Atomically adds v and returns the previous value. */
+	#define ARL_ATOMIC_FETCH_ADD_U32(ptr, v) __atomic_fetch_add((ptr), (v), __ATOMIC_RELAXED)
+	#define ARL_ATOMIC_FETCH_ADD_U64(ptr, v) __atomic_fetch_add((ptr), (v), __ATOMIC_RELAXED)
+
+	/** Replaces *ptr by desired if it equals expected. True on success. */
+	#define ARL_ATOMIC_CAS_U32(ptr, expected, desired) \
+		__extension__ ({ uint32_t arl_exp_ = (expected); \
+			__atomic_compare_exchange_n((ptr), &arl_exp_, (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED); })
+
+	/** Acquire load / release store. */
+	#define ARL_ATOMIC_LOAD_U32(ptr)     __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+	#define ARL_ATOMIC_STORE_U32(ptr, v) __atomic_store_n((ptr), (v), __ATOMIC_RELEASE)
+	#define ARL_ATOMIC_STORE_U16(ptr, v) __atomic_store_n((ptr), (v), __ATOMIC_RELEASE)
+
+	/** Atomically sets bits in a 64-bit word. */
+	#define ARL_ATOMIC_OR_U64(ptr, v) ((void)__atomic_fetch_or((ptr), (v), __ATOMIC_RELAXED))
+
+	/** Acquire load / release store of a 64-bit counter. */
+	#define ARL_ATOMIC_LOAD_U64(ptr)     __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+	#define ARL_ATOMIC_STORE_U64(ptr, v) __atomic_store_n((ptr), (v), __ATOMIC_RELEASE)
+
+	/** Standalone fences (seqlocks: plain reads / writes between two counter accesses). */
+	#define ARL_ATOMIC_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+	#define ARL_ATOMIC_FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_DELTA_H
+#define ARLECS_DELTA_H
+
+#include <ArmelECS/arlecs.h>
+
+/**
+ * Delta format (little endian, unaligned, all integers are uint32) :
+ *
+ * [magic 'ALDT'] [entity_counter] [pool_count]
+ * pool_count x :
+ *   [component_id] [elem_size] [removed_count] [upsert_count]
+ *   removed_count x [entity]
+ *   upsert_count  x [entity] [elem_size bytes of data]
+ *
+ * Only pools holding at least one change are written.
+ */
+
+#define ARLECS_DELTA_MAGIC 0x54444C41u // "ALDT"
+
+/** Number of elements compared at once before falling back to per-entity checks. */
+#define ARLECS_DELTA_BLOCK 64
+
+/**
+ * @brief Byte writer over a caller-provided buffer (e.g. allocated in an arena).
+ * Writes past capacity are dropped and set overflow.
+ */
+typedef struct {
+	uint8_t* data;    ///< Destination buffer.
+	size_t size;      ///< Bytes written so far.
+	size_t capacity;  ///< Size of the buffer.
+	bool overflow;    ///< True if some bytes did not fit.
+} ArlByteStream;
+
+/**
+ * @brief Initializes a byte writer on a buffer.
+ */
+static inline void arlecs_stream_init(ArlByteStream* stream, void* buffer, size_t capacity) {
+	stream->data = (uint8_t*)buffer;
+	stream->size = 0;
+	stream->capacity = capacity;
+	stream->overflow = false;
+}
+
+/**
+ * @brief Appends bytes to a stream.
+ */
+static inline void arlecs_stream_write(ArlByteStream* stream, const void* src, size_t size) {
+	if (stream->overflow || size > stream->capacity - stream->size) {
+		stream->overflow = true;
+		return;
+	}
+	memcpy(stream->data + stream->size, src, size);
+	stream->size += size;
+}
+
+/**
+ * @brief Appends a uint32 to a stream.
+ */
+static inline void arlecs_stream_write_u32(ArlByteStream* stream, uint32_t value) {
+	arlecs_stream_write(stream, &value, sizeof(value));
+}
+
+// --- API ---
+
+/**
+ * @brief Encodes what changed from world a to world b.
+ * Both worlds must share the same component registry (e.g. b is a later state of a,
+ * or a snapshot made with arlecs_world_clone_into()).
+ * Pools are compared column by column, unchanged blocks are skipped with memcmp.
+ * @param a Previous state.
+ * @param b New state.
+ * @param out Receives the encoded delta.
+ * @return false if out overflowed (the delta is then incomplete).
+ */
+bool arlecs_world_diff(ArlEcsWorld* a, ArlEcsWorld* b, ArlByteStream* out);
+
+/**
+ * @brief Applies a delta produced by arlecs_world_diff() in place.
+ * Applied on a world equal to a, the world becomes equal to b.
+ * @param world The world to update.
+ * @param data Encoded delta.
+ * @param size Size of the delta in bytes.
+ * @return false if the delta is malformed, does not match the world registry, or
+ * names an entity the world never created or a transient one (the records read
+ * before the error are already applied).
+ */
+bool arlecs_world_apply_delta(ArlEcsWorld* world, const void* data, size_t size);
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_LOADER_H
+#define ARLECS_LOADER_H
+
+#include <stdio.h>
+#include <ArmelECS/arlecs.h>
+
+#ifndef _WIN32
+	#include <pthread.h>
+#endif
+
+/**
+ * Streaming world loader.
+ *
+ * Spawning a whole level region at once stalls the frame. The loader reads an
+ * entity stream in chunks on a background thread (two buffers: one being read,
+ * one being inserted), and arlecs_loader_step() inserts a bounded number of
+ * entities and/or microseconds per frame.
+ *
+ * Stream format (native endianness, u32 fields) :
+ * - Header : magic 'ALST', version, total entity count.
+ * - Chunks : n entities sharing the same k components, then k (id, elem_size)
+ *   pairs, then k columns of n * elem_size bytes each.
+ * A chunk is inserted with one slot reservation and one memcpy per column and
+ * sub-batch (arlecs_pool_reserve_slots / arlecs_pool_emplace).
+ * Entities get new IDs, in stream order.
+ */
+
+/** 'ALST' */
+#define ARLECS_LOADER_MAGIC 0x54534C41u
+#define ARLECS_LOADER_VERSION 1
+
+/** Maximum number of components in a chunk. */
+#define ARLECS_LOADER_MAX_COMPONENTS 32
+
+/** Entities inserted between two clock reads when a time budget is set. */
+#define ARLECS_LOADER_BATCH 256
+
+typedef enum {
+	ARL_LOAD_PENDING = 0, ///< Still loading, call arlecs_loader_step() again next frame.
+	ARL_LOAD_DONE,        ///< Every entity was inserted.
+	ARL_LOAD_ERROR        ///< Malformed stream, unknown or hashed component, or world full.
+} ArlLoadStatus;
+
+/**
+ * @brief Loader state. Read-only for users, except through the API.
+ */
+typedef struct {
+	ArlEcsWorld* world;
+	FILE* file;
+
+	// Double buffer, filled by the reader, drained by arlecs_loader_step()
+	uint8_t* buffers[2];
+	size_t buffer_size;
+	bool ready[2];        ///< Buffer holds a complete chunk.
+	uint32_t current;     ///< Buffer being inserted.
+	bool reader_done;     ///< No more chunks will come (end of stream or error).
+	bool read_error;
+	bool stop;
+
+	// Chunk being inserted
+	uint32_t chunk_done;  ///< Entities of the current chunk already inserted.
+
+	// Progress
+	uint64_t total;       ///< Entities announced by the stream header.
+	uint64_t loaded;      ///< Entities inserted so far.
+	ArlLoadStatus status;
+
+#ifndef _WIN32
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	bool synced;          ///< lock and changed were initialized by arlecs_loader_open().
+	bool threaded;
+#endif
+} ArlStreamLoader;
+
+// --- API ---
+
+/**
+ * @brief Starts loading a stream into a world.
+ * @param loader The loader to initialize.
+ * @param world The world receiving the entities (components must be registered).
+ * @param file Stream positioned on its header, owned by the loader until close.
+ * @param buffer_size Size of each I/O buffer, must hold the largest chunk.
+ * @param arena Arena for the two buffers (not the world arena if it is snapshotted).
+ * @return false if the header is invalid. arlecs_loader_close() may still be called.
+ */
+bool arlecs_loader_open(ArlStreamLoader* loader, ArlEcsWorld* world, FILE* file, size_t buffer_size, Armel* arena);
+
+/**
+ * @brief Inserts entities until a budget is spent. Never waits for the disk:
+ * if the next chunk is not read yet, it returns and tries again next call.
+ * @param max_entities Max entities per call (0 = unlimited).
+ * @param max_us Max time per call in microseconds (0 = unlimited).
+ * @return The loading status.
+ */
+ArlLoadStatus arlecs_loader_step(ArlStreamLoader* loader, uint32_t max_entities, uint32_t max_us);
+
+/**
+ * @brief Fraction of the announced entities inserted so far (0 to 1).
+ */
+static inline float arlecs_loader_progress(const ArlStreamLoader* loader) {
+	return loader->total ? (float)((double)loader->loaded / (double)loader->total) : 1.0f;
+}
+
+/**
+ * @brief Stops the reader thread. The file is not closed.
+ */
+void arlecs_loader_close(ArlStreamLoader* loader);
+
+/**
+ * @brief Writes a stream header.
+ * @param total Number of entities in the whole stream.
+ */
+bool arlecs_loader_write_header(FILE* file, uint32_t total);
+
+/**
+ * @brief Writes a chunk of n entities owning the same k components.
+ * @param ids Component IDs (k).
+ * @param sizes Element size of each component (k).
+ * @param columns Packed component data, n elements per column (k).
+ */
+bool arlecs_loader_write_chunk(FILE* file, uint32_t n, uint32_t k,
+                               const uint32_t* ids, const uint32_t* sizes, const void* const* columns);
+
+#endif
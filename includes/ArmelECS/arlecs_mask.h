@@ -0,0 +1,143 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_MASK_H
+#define ARLECS_MASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/**
+ * Maximum number of distinct component types (IDs) allowed in the world.
+ * Can be overridden at compile time (-DARLECS_MAX_COMPONENT_TYPES=512).
+ */
+#ifndef ARLECS_MAX_COMPONENT_TYPES
+	#define ARLECS_MAX_COMPONENT_TYPES 256
+#endif
+
+/**
+ * @def ARL_CTZ64
+ * @brief Index of the lowest set bit of a non-zero 64-bit word.
+ *
+ * @def ARL_POPCOUNT64
+ * @brief Number of set bits in a 64-bit word.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+	static inline uint32_t arl_ctz64_msvc(uint64_t x) { unsigned long i; _BitScanForward64(&i, x); return (uint32_t)i; }
+	#define ARL_CTZ64(x) arl_ctz64_msvc(x)
+	#define ARL_POPCOUNT64(x) ((uint32_t)__popcnt64(x))
+#else
+	#define ARL_CTZ64(x) ((uint32_t)__builtin_ctzll(x))
+	#define ARL_POPCOUNT64(x) ((uint32_t)__builtin_popcountll(x))
+#endif
+
+/** Number of 64-bit words needed to hold one bit per component type. */
+#define ARLECS_MASK_WORDS ((ARLECS_MAX_COMPONENT_TYPES + 63) / 64)
+
+/**
+ * @brief Fixed-width set of component IDs (one bit per component type).
+ * * The width is a compile-time constant, so every operation below is a short
+ * loop of independent 64-bit word operations: compilers unroll it and turn it
+ * into SSE/AVX/NEON instructions. Word-wise tests never branch per component.
+ */
+typedef struct {
+	uint64_t words[ARLECS_MASK_WORDS];
+} ArlComponentMask;
+
+/**
+ * @brief Empties a mask.
+ */
+static inline void arlecs_mask_clear(ArlComponentMask* mask) {
+	memset(mask->words, 0, sizeof(mask->words));
+}
+
+/**
+ * @brief Adds a component ID to the mask.
+ */
+static inline void arlecs_mask_set(ArlComponentMask* mask, uint32_t id) {
+	mask->words[id >> 6] |= (uint64_t)1 << (id & 63);
+}
+
+/**
+ * @brief Removes a component ID from the mask.
+ */
+static inline void arlecs_mask_unset(ArlComponentMask* mask, uint32_t id) {
+	mask->words[id >> 6] &= ~((uint64_t)1 << (id & 63));
+}
+
+/**
+ * @brief Checks if a component ID belongs to the mask.
+ */
+static inline bool arlecs_mask_test(const ArlComponentMask* mask, uint32_t id) {
+	return (mask->words[id >> 6] >> (id & 63)) & 1;
+}
+
+/**
+ * @brief Checks if set contains every component of sub ((set & sub) == sub).
+ */
+static inline bool arlecs_mask_contains(const ArlComponentMask* set, const ArlComponentMask* sub) {
+	uint64_t missing = 0;
+	// No early exit: keeps the loop branchless and vectorizable
+	for (uint32_t i = 0; i < ARLECS_MASK_WORDS; i++) {
+		missing |= sub->words[i] & ~set->words[i];
+	}
+	return missing == 0;
+}
+
+/**
+ * @brief Checks if two masks share at least one component.
+ */
+static inline bool arlecs_mask_intersects(const ArlComponentMask* a, const ArlComponentMask* b) {
+	uint64_t common = 0;
+	for (uint32_t i = 0; i < ARLECS_MASK_WORDS; i++) {
+		common |= a->words[i] & b->words[i];
+	}
+	return common != 0;
+}
+
+/**
+ * @brief Checks if a mask holds no component.
+ */
+static inline bool arlecs_mask_empty(const ArlComponentMask* mask) {
+	uint64_t any = 0;
+	for (uint32_t i = 0; i < ARLECS_MASK_WORDS; i++) {
+		any |= mask->words[i];
+	}
+	return any == 0;
+}
+
+/**
+ * @brief dst |= src
+ */
+static inline void arlecs_mask_or(ArlComponentMask* dst, const ArlComponentMask* src) {
+	for (uint32_t i = 0; i < ARLECS_MASK_WORDS; i++) {
+		dst->words[i] |= src->words[i];
+	}
+}
+
+/**
+ * @brief Returns the first component ID >= from present in the mask.
+ * Usage :
+ * for (uint32_t id = arlecs_mask_next(&m, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(&m, id + 1))
+ * @return The component ID, or ARLECS_MAX_COMPONENT_TYPES if there is none.
+ */
+static inline uint32_t arlecs_mask_next(const ArlComponentMask* mask, uint32_t from) {
+	uint32_t word = from >> 6;
+	if (word >= ARLECS_MASK_WORDS) return ARLECS_MAX_COMPONENT_TYPES;
+
+	uint64_t bits = mask->words[word] & (~(uint64_t)0 << (from & 63));
+	while (bits == 0) {
+		if (++word >= ARLECS_MASK_WORDS) return ARLECS_MAX_COMPONENT_TYPES;
+		bits = mask->words[word];
+	}
+
+	uint32_t id = (word << 6) + ARL_CTZ64(bits);
+	return id < ARLECS_MAX_COMPONENT_TYPES ? id : ARLECS_MAX_COMPONENT_TYPES;
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_MEM_H
+#define ARLECS_MEM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <Armel/armel.h>
+
+/**
+ * Memory backing hints for large pools.
+ * With millions of entities, the random sparse lookups of a view touch a new
+ * 4 KB page almost every time: huge pages (2 MB) remove most of the TLB misses.
+ * All hints are best effort: the returned flags tell what the system accepted.
+ */
+
+/** No hint. */
+#define ARLECS_MEM_DEFAULT   0x00
+
+/** Transparent huge pages (madvise MADV_HUGEPAGE). */
+#define ARLECS_MEM_HUGEPAGES 0x01
+
+/** Bind the memory to a NUMA node (mbind). */
+#define ARLECS_MEM_NUMA      0x02
+
+/** Explicit huge pages (mmap MAP_HUGETLB), only for arenas created by arlecs_arena_new_huge(). */
+#define ARLECS_MEM_HUGETLB   0x04
+
+/** Size of a huge page on x86_64 / arm64 Linux. */
+#define ARLECS_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/**
+ * @brief Applies memory hints to a range (only the whole pages inside it are affected).
+ * @param ptr Start of the range.
+ * @param size Size of the range in bytes.
+ * @param flags ARLECS_MEM_HUGEPAGES and/or ARLECS_MEM_NUMA.
+ * @param numa_node Node for ARLECS_MEM_NUMA.
+ * @return The subset of flags the system accepted.
+ */
+uint32_t arlecs_mem_advise(void* ptr, size_t size, uint32_t flags, int numa_node);
+
+/**
+ * @brief Creates an arena backed by explicit huge pages when available.
+ * Falls back to regular pages (with the transparent huge page hint) if the
+ * system has no huge page reserved. Release it with arl_free().
+ * @param armel The arena to initialize.
+ * @param size Capacity in bytes (rounded up to ARLECS_HUGE_PAGE_SIZE).
+ * @param flags ARLECS_MEM_* hints (ARLECS_MEM_HUGETLB is implied).
+ * @param numa_node Node for ARLECS_MEM_NUMA.
+ * @return The subset of flags the system accepted.
+ */
+uint32_t arlecs_arena_new_huge(Armel* armel, size_t size, uint32_t flags, int numa_node);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_PERSIST_H
+#define ARLECS_PERSIST_H
+
+#include <ArmelECS/arlecs.h>
+
+/**
+ * File-backed persistent arena.
+ *
+ * The arena lives in a file mapped with MAP_SHARED: every write to the world is a
+ * write to the page cache, and msync() checkpoints flush it to disk. A restarted
+ * (or crashed) process reopens the file and gets its world back without parsing
+ * anything. The mapping is first requested at its previous address; if the system
+ * places it elsewhere, the world pointers are shifted by the difference
+ * (arlecs_world_relocate, O(component types)).
+ *
+ * Rules :
+ * - Only the world (pools, resources) is relocated. Other structures stored in the
+ *   arena that hold pointers (spatial index, system manager...) must be rebuilt.
+ * - Checkpoint after registering components: allocations made after the last
+ *   checkpoint are not remembered by the file header.
+ * - The file is tied to the build: a different ArlEcsWorld layout is refused.
+ * POSIX only, arlecs_persist_open() returns false elsewhere.
+ */
+
+/** Bytes reserved at the start of the file for the header (one page). */
+#define ARLECS_PERSIST_HEADER_SIZE 4096
+
+/** 'ALPF' */
+#define ARLECS_PERSIST_MAGIC 0x46504C41u
+#define ARLECS_PERSIST_VERSION 1
+
+/**
+ * @brief Header stored at the start of the file.
+ */
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t world_size;      ///< sizeof(ArlEcsWorld) of the build that wrote the file.
+	uint32_t max_components;  ///< ARLECS_MAX_COMPONENT_TYPES of that build.
+	uint64_t size;            ///< Size of the file / mapping in bytes.
+	uint64_t base;            ///< Address of the mapping when the file was last open.
+	uint64_t cursor;          ///< Arena cursor, as an offset from the start of the file.
+	uint64_t world;           ///< World offset from the start of the file (0 = none yet).
+} ArlPersistHeader;
+
+/**
+ * @brief A persistent arena and its mapping.
+ */
+typedef struct {
+	Armel arena;              ///< Arena over the file, after the header. Do not arl_free() it.
+	ArlPersistHeader* header; ///< Start of the mapping.
+	size_t size;              ///< Size of the mapping.
+	int fd;                   ///< File descriptor.
+	ArlEcsWorld* world;       ///< World found in (or created by arlecs_persist_world in) the file.
+	bool relocated;           ///< True if the file was mapped at another address than last time.
+} ArlPersistentArena;
+
+// --- API ---
+
+/**
+ * @brief Opens (or creates) a persistent arena.
+ * An existing file keeps its own size, its world is ready in pa->world.
+ * @param pa The persistent arena to initialize.
+ * @param path File path.
+ * @param size Size of a new file in bytes (header included).
+ * @return false if the file cannot be created or mapped, or if it is not empty
+ * and is not a world of this build (the file is then left untouched).
+ */
+bool arlecs_persist_open(ArlPersistentArena* pa, const char* path, size_t size);
+
+/**
+ * @brief Returns the world stored in the file, or creates it on first use.
+ * @param max_entities Capacity of a new world (ignored if the file already has one).
+ */
+ArlEcsWorld* arlecs_persist_world(ArlPersistentArena* pa, uint32_t max_entities);
+
+/**
+ * @brief Records the arena cursor in the header and flushes the mapping.
+ * @param blocking true waits for the data to reach the disk (MS_SYNC), false only schedules it.
+ * @return false if msync failed.
+ */
+bool arlecs_persist_checkpoint(ArlPersistentArena* pa, bool blocking);
+
+/**
+ * @brief Checkpoints (blocking), unmaps and closes the file.
+ */
+void arlecs_persist_close(ArlPersistentArena* pa);
+
+#endif
@@ -7,13 +7,20 @@
 #include <assert.h>
 
 #include <Armel/armel.h>
+#include <ArmelECS/arlecs_mask.h> // ARL_CTZ64
 
 
 /**
  * @brief Unique identifier for an entity.
  * An entity is just an index. It contains no data itself.
+ * Define ARLECS_COMPACT_ENTITY for small worlds (at most 65535 entities):
+ * handles and dense arrays are then 16 bits wide.
  */
-typedef uint32_t ArlEntity;
+#ifdef ARLECS_COMPACT_ENTITY
+	typedef uint16_t ArlEntity;
+#else
+	typedef uint32_t ArlEntity;
+#endif
 
 /**
  * @brief Sentinel value representing an invalid or null entity ID.
@@ -21,6 +28,86 @@ typedef uint32_t ArlEntity;
  */
 #define ARL_NULL_ID 0xFFFFFFFF
 
+/**
+ * @brief ARL_NULL_ID as an ArlEntity (marks the dead slots of dense arrays).
+ * Compare entities read from a dense array with this one, not with ARL_NULL_ID.
+ */
+#define ARL_NULL_ENTITY ((ArlEntity)ARL_NULL_ID)
+
+/**
+ * @brief Storage mode flags of a pool (see ArlPoolDesc).
+ * - ARLECS_POOL_DEFAULT : removal fills the hole with the last element (swap & pop).
+ * - ARLECS_POOL_STABLE  : removal leaves a tombstone, components never move until
+ *   the pool is compacted. For large components with heavy churn, or when outside
+ *   pointers to components must stay valid during the frame.
+ */
+#define ARLECS_POOL_DEFAULT 0x0
+#define ARLECS_POOL_STABLE  0x1
+
+/**
+ * @brief ARLECS_POOL_BITSET : the pool also keeps a two-level membership bitset
+ * (one bit per entity, one top bit per 64-entity word) for arlecs_bitset_view().
+ * Costs capacity / 8 bytes, and one bit update per add / remove.
+ */
+#define ARLECS_POOL_BITSET  0x2
+
+/**
+ * @brief ARLECS_POOL_INDEX16 : the sparse array stores 16-bit dense indices.
+ * Halves the sparse array (twice as many entries per cache line), for components
+ * that never have more than ARLECS_INDEX16_MAX instances, even in a large world.
+ * Widths can be mixed freely inside a view.
+ */
+#define ARLECS_POOL_INDEX16 0x4
+
+/**
+ * @brief ARLECS_POOL_PADDED : the stride between two components is rounded up to
+ * the pool alignment, so every component starts on an aligned address (e.g. a
+ * 12-byte float3 stored every 16 bytes for aligned SIMD loads).
+ * pool->elem_size is then the padded stride: typed accessors (arlecs_typed.h)
+ * need a type whose sizeof() already equals it.
+ */
+#define ARLECS_POOL_PADDED 0x8
+
+/**
+ * @brief ARLECS_POOL_HASHED : for very rare components (a boss, a quest target).
+ * Instead of a max_entities-sized sparse array, entity -> dense index goes through
+ * a small open-addressing hash table (linear probing, twice max_count slots).
+ * Lookups cost a hash and a short probe; views and arlecs_get_component() work
+ * unchanged. Concurrent adds are not supported on hashed pools.
+ */
+#define ARLECS_POOL_HASHED 0x10
+
+/** Default max_count of a hashed pool. */
+#define ARLECS_POOL_HASH_CAPACITY 1024
+
+/** Minimum alignment of the component data of every pool (one cache line). */
+#define ARLECS_POOL_DATA_ALIGN 64
+
+/** Maximum number of components of an ARLECS_POOL_INDEX16 pool (0xFFFF is the empty entry). */
+#define ARLECS_INDEX16_MAX 0xFFFF
+
+/** Default tombstone ratio (tombstones / dense slots) above which arlecs_world_compact() compacts a stable pool. */
+#define ARLECS_POOL_COMPACT_RATIO 0.25f
+
+/**
+ * @brief Describes how a component pool stores its elements.
+ */
+typedef struct {
+	size_t elem_size;      ///< Size of the component struct (sizeof(T)).
+	uint32_t flags;        ///< ARLECS_POOL_* storage mode.
+	float compact_ratio;   ///< Stable pools: tombstone ratio triggering compaction (0 = ARLECS_POOL_COMPACT_RATIO).
+	size_t align;          ///< Alignment of the component (power of two, 0 = none). Data is aligned to max(align, ARLECS_POOL_DATA_ALIGN).
+	uint32_t max_count;    ///< Maximum number of components (0 = max_entities, ARLECS_POOL_HASH_CAPACITY for hashed pools).
+} ArlPoolDesc;
+
+/**
+ * @brief An entry of the hash table of an ARLECS_POOL_HASHED pool.
+ */
+typedef struct {
+	uint32_t entity;       ///< Key (ARL_NULL_ID = empty).
+	uint32_t index;        ///< Dense index.
+} ArlHashSlot;
+
 /**
  * @brief A Generic Sparse Set implementation.
  * * Stores ONE type of component (e.g., Position) for entities.
@@ -29,13 +116,46 @@ typedef uint32_t ArlEntity;
  * 2. O(1) Iteration: dense[0...count] are packed contiguously
  */
 typedef struct {
-	size_t elem_size;      ///< Size of a single component in bytes.
+	size_t elem_size;      ///< Stride of a component in bytes (sizeof(T), rounded up to align with ARLECS_POOL_PADDED).
+	size_t type_size;      ///< Size of the component struct as registered (sizeof(T)).
+	size_t align;          ///< Alignment of 'data' in bytes, at least ARLECS_POOL_DATA_ALIGN.
 	uint32_t count;        ///< Number of active components.
 	uint32_t capacity;     ///< Maximum number of entities supported (Fixed).
+	uint32_t dense_capacity; ///< Maximum number of components (capacity, or less with max_count / 16-bit indices).
 
-	uint32_t* sparse;      ///< [EntityID] -> Index in 'dense' array.
+	uint8_t* sparse;       ///< [EntityID] -> Index in 'dense' array, entries of (1 << sparse_shift) bytes. NULL for hashed pools.
+	uint32_t sparse_shift; ///< log2 of the entry size: 2 (32-bit indices) or 1 (16-bit indices).
+	uint32_t sparse_mask;  ///< Mask of an entry, also its empty value (0xFFFFFFFF or 0xFFFF).
+	uint32_t sparse_limit; ///< Entities covered by 'sparse': capacity, 0 for hashed pools (see arlecs_pool_index).
 	ArlEntity* dense;      ///< [Index] -> EntityID (Reverse map).
 	uint8_t* data;         ///< [Index] -> Packed component data.
+
+	// Lifetime counters (see arlecs_world_stats)
+	uint64_t adds;         ///< Number of components added.
+	uint64_t removes;      ///< Number of components removed.
+	uint64_t swaps;        ///< Number of elements moved to fill a hole.
+	uint64_t touches;      ///< Data writes signaled with arlecs_pool_touch() (see arlecs_pool_version).
+
+	uint32_t mem_flags;    ///< ARLECS_MEM_* hints accepted by the system for this pool (see arlecs_pool_advise).
+
+	// Stable mode (ARLECS_POOL_STABLE)
+	uint32_t flags;            ///< ARLECS_POOL_* storage mode.
+	uint32_t tombstones;       ///< Dead slots in [0, count), their dense entry is ARL_NULL_ENTITY.
+	uint32_t free_head;        ///< First reusable dead slot, the next link is stored in its data.
+	float compact_ratio;       ///< Tombstone ratio triggering compaction.
+	uint64_t* tombstone_bits;  ///< [dense_capacity bits] Set for dead slots (NULL for default pools).
+
+	// Transient components (see arlecs_world_reserve_transients)
+	uint32_t transient_count;  ///< Components of transient entities, stored in [count - transient_count, count).
+
+	// Hashed storage (ARLECS_POOL_HASHED)
+	ArlHashSlot* hash;         ///< [hash_mask + 1] Entity -> dense index, replaces 'sparse' (NULL for other pools).
+	uint32_t hash_mask;        ///< Table size - 1 (a power of two).
+	uint32_t hash_shift;       ///< 32 - log2(table size), for the multiplicative hash.
+
+	// Membership bitset (ARLECS_POOL_BITSET)
+	uint64_t* bits;            ///< [capacity bits] Bit e is set if entity e owns the component (NULL if disabled).
+	uint64_t* bits_top;        ///< [capacity / 64 bits] Bit w is set if bits[w] != 0.
 } ArlPool;
 
 // --- API ---
@@ -49,6 +169,35 @@ typedef struct {
  */
 ArlPool* arlecs_pool_new(Armel* arena, size_t elem_size, uint32_t max_entities);
 
+/**
+ * @brief Allocates and initializes a new component pool from a descriptor.
+ * @param arena The memory arena to use.
+ * @param desc Element size and storage mode.
+ * @param max_entities Hard limit on the number of entities this pool can track.
+ * @return A pointer to the new pool.
+ */
+ArlPool* arlecs_pool_new_desc(Armel* arena, const ArlPoolDesc* desc, uint32_t max_entities);
+
+/**
+ * @brief Same as arlecs_pool_new_desc(), with memory hints applied to the arrays
+ * before they are first touched (a page already faulted in keeps its size and node).
+ * @param mem_flags ARLECS_MEM_HUGEPAGES and/or ARLECS_MEM_NUMA (see arlecs_mem.h).
+ * @param numa_node Node for ARLECS_MEM_NUMA.
+ */
+ArlPool* arlecs_pool_new_ex(Armel* arena, const ArlPoolDesc* desc, uint32_t max_entities, uint32_t mem_flags, int numa_node);
+
+/**
+ * @brief Requests huge pages and/or NUMA binding for the arrays of a pool.
+ * Pages already touched (the sparse array is filled at creation) keep their
+ * size and node until the kernel collapses or migrates them: prefer
+ * arlecs_pool_new_ex(), which advises before the first write.
+ * @param pool The pool.
+ * @param flags ARLECS_MEM_HUGEPAGES and/or ARLECS_MEM_NUMA (see arlecs_mem.h).
+ * @param numa_node Node for ARLECS_MEM_NUMA.
+ * @return The hints accepted for all the arrays (also stored in pool->mem_flags).
+ */
+uint32_t arlecs_pool_advise(ArlPool* pool, uint32_t flags, int numa_node);
+
 /**
  * @brief Adds a component to an entity.
  * If the entity already has this component, it returns the existing data.
@@ -56,25 +205,261 @@ ArlPool* arlecs_pool_new(Armel* arena, size_t elem_size, uint32_t max_entities);
  */
 void* arlecs_pool_add(ArlPool* pool, ArlEntity entity);
 
+/**
+ * @brief Thread-safe version of arlecs_pool_add() for entities new to the pool.
+ * Several threads may add at the same time as long as :
+ * - each entity is added by a single thread (e.g. IDs from arlecs_reserve_entities()),
+ * - the entity is not in the pool yet,
+ * - nobody removes, clears or iterates the pool meanwhile,
+ * - the pool holds no transient component,
+ * - the pool is not hashed (ARLECS_POOL_HASHED).
+ * @return A pointer to the memory where data should be written, NULL if the pool is full or hashed.
+ */
+void* arlecs_pool_add_concurrent(ArlPool* pool, ArlEntity entity);
+
+/**
+ * @brief Reserves n consecutive dense slots (thread-safe, lock-free).
+ * Fill each slot with arlecs_pool_emplace(). Same rules as arlecs_pool_add_concurrent().
+ * @return The first reserved slot, or ARL_NULL_ID if the pool cannot hold n more components or is hashed.
+ */
+uint32_t arlecs_pool_reserve_slots(ArlPool* pool, uint32_t n);
+
+/**
+ * @brief Publishes an entity in a slot reserved by arlecs_pool_reserve_slots().
+ * @return A pointer to the memory where data should be written.
+ */
+void* arlecs_pool_emplace(ArlPool* pool, uint32_t slot, ArlEntity entity);
+
+/**
+ * @brief Adds a membership bitset to an existing pool (see ARLECS_POOL_BITSET).
+ * The bitset is allocated in arena and filled from the current components.
+ */
+void arlecs_pool_enable_bitset(ArlPool* pool, Armel* arena);
+
 /**
  * @brief Removes a component from an entity using "Swap & Pop".
  * @warning This moves the last element of the array to fill the hole.
  * Any pointers to components of this type held externally may become invalid.
+ * Stable pools leave a tombstone instead, nothing moves (see ARLECS_POOL_STABLE).
  */
 void arlecs_pool_remove(ArlPool* pool, ArlEntity entity);
 
 /**
- * @brief Retrieves a component for an entity (Inline for performance).
- * @return Pointer to the data, or NULL if not present.
+ * @brief Adds the component to n consecutive entities [first, first + n), all new
+ * to the pool. Their slots are contiguous; dense and sparse are written in one pass.
+ * Transient components, if any, stay at the end of the pool.
+ * @return The data of the first slot (entity first + i is at index i), NULL if the pool is full.
  */
-static inline void* arlecs_pool_get(ArlPool* pool, ArlEntity entity) {
-	if (entity >= pool->capacity) return NULL;
+void* arlecs_pool_add_run(ArlPool* pool, ArlEntity first, uint32_t n);
+
+/**
+ * @brief Adds a component to a transient entity. It is stored in the tail of the
+ * pool, after every persistent component, and dropped by arlecs_pool_expire_transients().
+ * @return A pointer to the memory where data should be written, NULL if the pool is full.
+ */
+void* arlecs_pool_add_transient(ArlPool* pool, ArlEntity entity);
+
+/**
+ * @brief Drops every transient component in O(1): the tail is cut off, nothing
+ * is removed one by one and the sparse array is not touched (its stale entries
+ * fail the dense check of arlecs_pool_index()).
+ * @param first First transient entity ID, used to clear the membership bitset.
+ * @param n Number of transient entity IDs.
+ */
+void arlecs_pool_expire_transients(ArlPool* pool, ArlEntity first, uint32_t n);
+
+/**
+ * @brief Predicate for arlecs_pool_remove_if().
+ * @param entity The owner of the component.
+ * @param data The component.
+ * @return true to remove the component.
+ */
+typedef bool (*ArlPoolPredicate)(ArlEntity entity, void* data, void* ctx);
+
+/**
+ * @brief Removes every component matching a predicate in one left-to-right pass.
+ * Survivors slide down and keep their relative order; the sparse array is only
+ * written for the moved and removed elements. Tombstones are compacted too.
+ * @warning Components move: pointers held externally become invalid.
+ * @return The number of components removed.
+ */
+uint32_t arlecs_pool_remove_if(ArlPool* pool, ArlPoolPredicate pred, void* ctx);
+
+/**
+ * @brief Removes the components of a list of entities, then compacts the pool in
+ * one pass starting at the first hole (same ordering guarantees as remove_if).
+ * Entities without the component and duplicates are ignored.
+ * @return The number of components removed.
+ */
+uint32_t arlecs_pool_remove_batch(ArlPool* pool, const ArlEntity* entities, uint32_t n);
+
+/**
+ * @brief Removes the tombstones of a stable pool in one sequential pass.
+ * The live components keep their relative order.
+ * @warning Components move: pointers held externally become invalid.
+ */
+void arlecs_pool_compact(ArlPool* pool);
+
+/**
+ * @brief Checks if a stable pool passed its compaction threshold.
+ */
+static inline bool arlecs_pool_needs_compaction(const ArlPool* pool) {
+	return pool->tombstones && (float)pool->tombstones > pool->compact_ratio * (float)pool->count;
+}
+
+/**
+ * @brief Moves the internal pointers of a pool whose memory was copied elsewhere.
+ * Every pointer inside [lo, hi) is shifted by delta bytes, other pointers are left untouched.
+ * @param pool The pool (already at its new location).
+ * @param lo Start of the old memory range.
+ * @param hi End of the old memory range.
+ * @param delta New address - old address.
+ */
+void arlecs_pool_relocate(ArlPool* pool, uintptr_t lo, uintptr_t hi, intptr_t delta);
+
+/**
+ * @brief Shifts a pointer by delta bytes if it points inside [lo, hi).
+ */
+static inline void* arl_relocate_ptr(void* ptr, uintptr_t lo, uintptr_t hi, intptr_t delta) {
+	uintptr_t p = (uintptr_t)ptr;
+	return (p >= lo && p < hi) ? (void*)(p + (uintptr_t)delta) : ptr;
+}
+
+/**
+ * @brief Internal: home slot of an entity in the hash table (Fibonacci hashing).
+ */
+static inline uint32_t arlecs_hash_home(const ArlPool* pool, uint32_t entity) {
+	return (entity * 2654435769u) >> pool->hash_shift;
+}
+
+/**
+ * @brief Internal: looks an entity up in the hash table of a hashed pool.
+ * @return The dense index, or ARL_NULL_ID.
+ */
+static inline uint32_t arlecs_hash_find(const ArlPool* pool, ArlEntity entity) {
+	uint32_t slot = arlecs_hash_home(pool, entity);
+	for (;;) {
+		const ArlHashSlot* h = &pool->hash[slot];
+		if (h->entity == (uint32_t)entity) return h->index;
+		if (h->entity == ARL_NULL_ID) return ARL_NULL_ID;
+		slot = (slot + 1) & pool->hash_mask;
+	}
+}
+
+/**
+ * @brief Internal: inserts, updates or (with ARL_NULL_ID) erases the entry of an entity in a hashed pool.
+ */
+void arlecs_hash_store(ArlPool* pool, ArlEntity entity, uint32_t index);
+
+/**
+ * @brief Internal: resolves the dense index of an entity in a hashed pool.
+ * @return Index in 'dense' / 'data', or ARL_NULL_ID if the entity is not in the pool.
+ */
+static inline uint32_t arlecs_hash_index(const ArlPool* pool, ArlEntity entity) {
+	uint32_t index = arlecs_hash_find(pool, entity);
+	if (index >= pool->count || pool->dense[index] != entity) return ARL_NULL_ID;
+
+	return index;
+}
+
+/**
+ * @brief Reads the raw sparse entry of an entity, whatever the index width.
+ * Branchless: always a 4-byte load (the array is padded) masked to the entry width.
+ * Only for entity < pool->sparse_limit (hashed pools have no sparse array, see arlecs_hash_find).
+ * @return The dense index, or pool->sparse_mask if the entry is empty.
+ */
+static inline uint32_t arlecs_sparse_load(const ArlPool* pool, ArlEntity entity) {
+	uint32_t value;
+	memcpy(&value, pool->sparse + ((size_t)entity << pool->sparse_shift), sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value >>= 32 - (8u << pool->sparse_shift);
+#endif
+	return value & pool->sparse_mask;
+}
+
+/**
+ * @brief Writes the sparse entry of an entity (ARL_NULL_ID empties it).
+ * Pools with a sparse array only, hashed pools use arlecs_hash_store().
+ */
+static inline void arlecs_sparse_store(ArlPool* pool, ArlEntity entity, uint32_t index) {
+	uint8_t* entry = pool->sparse + ((size_t)entity << pool->sparse_shift);
+	if (pool->sparse_shift == 1) {
+		uint16_t narrow = (uint16_t)index;
+		memcpy(entry, &narrow, sizeof(narrow));
+	} else {
+		memcpy(entry, &index, sizeof(index));
+	}
+}
+
+/**
+ * @brief Resolves the dense index of an entity (Inline for performance).
+ * @return Index in 'dense' / 'data', or ARL_NULL_ID if the entity is not in the pool.
+ */
+static inline uint32_t arlecs_pool_index(const ArlPool* pool, ArlEntity entity) {
+	// Hashed pools have sparse_limit = 0: they take the bound check's cold path,
+	// the sparse path costs the same single comparison as before
+	if (entity >= pool->sparse_limit) return pool->hash ? arlecs_hash_index(pool, entity) : ARL_NULL_ID;
 	
-	uint32_t index = pool->sparse[entity];
+	// An empty entry (sparse_mask) is never below count
+	uint32_t index = arlecs_sparse_load(pool, entity);
 
 	// Check if the index points to a valid entry in the dense array
 	// (Double check required for sparse set validity)
-	if (index >= pool->count || pool->dense[index] != entity) return NULL;
+	if (index >= pool->count || pool->dense[index] != entity) return ARL_NULL_ID;
+
+	return index;
+}
+
+/**
+ * @brief Returns the first live dense index >= index (tombstones are skipped 64 at a time).
+ * @return The index, or pool->count if there is none.
+ */
+static inline uint32_t arlecs_pool_next_live(const ArlPool* pool, uint32_t index) {
+	if (! pool->tombstones) return index;
+
+	while (index < pool->count) {
+		uint64_t live = ~pool->tombstone_bits[index >> 6] >> (index & 63);
+		if (live) {
+			index += ARL_CTZ64(live);
+			break;
+		}
+		index = (index | 63) + 1;
+	}
+
+	return index < pool->count ? index : pool->count;
+}
+
+/**
+ * @brief Number of live components (dense slots minus tombstones).
+ */
+static inline uint32_t arlecs_pool_size(const ArlPool* pool) {
+	return pool->count - pool->tombstones;
+}
+
+/**
+ * @brief Signals that components of the pool were modified in place.
+ * Systems declaring arlecs_sys_write() on the pool do it automatically after each run,
+ * and so do the library paths writing data in place (delta apply, loader, prefab overrides).
+ */
+static inline void arlecs_pool_touch(ArlPool* pool) {
+	pool->touches++;
+}
+
+/**
+ * @brief Change stamp of a pool: grows on every add, removal or touch.
+ * Two equal stamps mean the pool did not change in between (element moves aside).
+ */
+static inline uint64_t arlecs_pool_version(const ArlPool* pool) {
+	return pool->adds + pool->removes + pool->touches;
+}
+
+/**
+ * @brief Retrieves a component for an entity (Inline for performance).
+ * @return Pointer to the data, or NULL if not present.
+ */
+static inline void* arlecs_pool_get(ArlPool* pool, ArlEntity entity) {
+	uint32_t index = arlecs_pool_index(pool, entity);
+	if (index == ARL_NULL_ID) return NULL;
 
 	return pool->data + (index * pool->elem_size);
 }
@@ -84,20 +469,54 @@ static inline void* arlecs_pool_get(ArlPool* pool, ArlEntity entity) {
  * @return true if present, false otherwise.
  */
 static inline bool arlecs_pool_has(ArlPool* pool, ArlEntity entity) {
-	if (entity >= pool->capacity) return false;
-	
-	uint32_t index = pool->sparse[entity];
 	// We confirm validity by checking if the dense array points back to us
-	return index < pool->count && pool->dense[index] == entity;
+	return arlecs_pool_index(pool, entity) != ARL_NULL_ID;
 }
 
+/**
+ * @brief Internal: marks an entity in the membership bitset.
+ */
+static inline void arlecs_pool_bit_set(ArlPool* pool, ArlEntity entity) {
+	uint32_t word = entity >> 6;
+	pool->bits[word] |= (uint64_t)1 << (entity & 63);
+	pool->bits_top[word >> 6] |= (uint64_t)1 << (word & 63);
+}
+
+/**
+ * @brief Internal: unmarks an entity, and its word in the top level once empty.
+ */
+static inline void arlecs_pool_bit_clear(ArlPool* pool, ArlEntity entity) {
+	uint32_t word = entity >> 6;
+	pool->bits[word] &= ~((uint64_t)1 << (entity & 63));
+	if (! pool->bits[word]) pool->bits_top[word >> 6] &= ~((uint64_t)1 << (word & 63));
+}
+
+/** Number of 64-bit words of the bitset levels for a capacity. */
+#define ARLECS_BITSET_WORDS(capacity) (((size_t)(capacity) + 63) / 64)
+#define ARLECS_BITSET_TOP_WORDS(capacity) ((ARLECS_BITSET_WORDS(capacity) + 63) / 64)
+
 /**
  * @brief Clears a pool, its sparse array contains now only 0
  * @param pool 
  */
 static inline void arlecs_pool_clear (ArlPool* pool) {
+	pool->removes += pool->count - pool->tombstones;
+
+	if (pool->tombstone_bits) {
+		memset(pool->tombstone_bits, 0, ((size_t)pool->count + 63) / 64 * sizeof(uint64_t));
+	}
+	pool->tombstones = 0;
+	pool->free_head = ARL_NULL_ID;
+	pool->transient_count = 0;
+
+	if (pool->bits) {
+		memset(pool->bits, 0, ARLECS_BITSET_WORDS(pool->capacity) * sizeof(uint64_t));
+		memset(pool->bits_top, 0, ARLECS_BITSET_TOP_WORDS(pool->capacity) * sizeof(uint64_t));
+	}
+
 	pool->count = 0;
-	memset(pool->sparse, 0xFF, pool->capacity * sizeof(uint32_t));
+	if (pool->hash) memset(pool->hash, 0xFF, ((size_t)pool->hash_mask + 1) * sizeof(ArlHashSlot));
+	else memset(pool->sparse, 0xFF, (size_t)pool->capacity << pool->sparse_shift);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_PREFAB_H
+#define ARLECS_PREFAB_H
+
+#include <ArmelECS/arlecs.h>
+
+/**
+ * Prefabs: stored templates of component values.
+ *
+ * arlecs_instantiate() spawns n copies of a prefab in bulk: n consecutive entity
+ * IDs, one slot run per pool (dense and sparse written in a single pass) and the
+ * template value replicated with doubling memcpy. An optional callback then
+ * customizes the instances, one contiguous column per component.
+ *
+ * Usage :
+ * ArlPrefab asteroid;
+ * arlecs_prefab_init(&asteroid, &assets); // Not the world arena: snapshots rewind it
+
+ * ((Mass*)arlecs_prefab_add(world, &asteroid, COMP_MASS))->m = 10.0f;
+ * arlecs_prefab_add(world, &asteroid, COMP_POS);
+ * ArlEntity first = arlecs_instantiate(world, &asteroid, 1000, NULL);
+ */
+
+/** Maximum number of components in a prefab. */
+#define ARLECS_PREFAB_MAX_COMPONENTS 16
+
+/**
+ * @brief A prefab. Template values are allocated in the arena given to arlecs_prefab_init().
+ */
+typedef struct {
+	Armel* arena;                                    ///< Arena holding the template values.
+	uint32_t count;                                  ///< Number of components.
+	uint32_t ids[ARLECS_PREFAB_MAX_COMPONENTS];      ///< Component IDs.
+	void* values[ARLECS_PREFAB_MAX_COMPONENTS];      ///< Template value of each component.
+} ArlPrefab;
+
+/**
+ * @brief Customizes a run of fresh instances.
+ * @param first First entity of the run, the others follow (first + 1, first + 2...).
+ * @param n Number of instances.
+ * @param columns One contiguous array per prefab component, in arlecs_prefab_add() order.
+ * Element i of a column belongs to entity first + i (stride: the pool elem_size).
+ */
+typedef void (*ArlPrefabOverride)(ArlEcsWorld* world, ArlEntity first, uint32_t n, void* const* columns, void* ctx);
+
+// --- API ---
+
+/**
+ * @brief Initializes an empty prefab.
+ * @param arena Arena for the template values. Use an arena outside the world:
+ * arlecs_world_restore() rewinds the world arena, and persisted or shared
+ * segments should not carry process-local templates.
+ */
+void arlecs_prefab_init(ArlPrefab* prefab, Armel* arena);
+
+/**
+ * @brief Adds a component to a prefab (or returns it if already there).
+ * @return The zero-initialized template value, to be filled by the caller.
+ */
+void* arlecs_prefab_add(ArlEcsWorld* world, ArlPrefab* prefab, uint32_t component_id);
+
+/**
+ * @brief Spawns n instances of a prefab.
+ * @param out_ids Receives the n new entity IDs (may be NULL, they are consecutive).
+ * @return The first new entity, or ARL_NULL_ENTITY if the world or one of the pools
+ * cannot hold n more (nothing is created then).
+ */
+ArlEntity arlecs_instantiate(ArlEcsWorld* world, const ArlPrefab* prefab, uint32_t n, ArlEntity* out_ids);
+
+/**
+ * @brief Same as arlecs_instantiate(), then calls 'override' once on the n instances.
+ */
+ArlEntity arlecs_instantiate_ex(ArlEcsWorld* world, const ArlPrefab* prefab, uint32_t n, ArlEntity* out_ids,
+                                ArlPrefabOverride override, void* ctx);
+
+#endif
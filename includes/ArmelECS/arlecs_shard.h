@@ -0,0 +1,113 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_SHARD_H
+#define ARLECS_SHARD_H
+
+#include <ArmelECS/arlecs.h>
+#include <ArmelECS/arlecs_workers.h>
+
+/** Maximum number of shards in a sharded world. */
+#define ARLECS_MAX_SHARDS 16
+
+/**
+ * @brief A world split in N independent worlds (shards).
+ * * Each shard lives in its own Armel arena (allocate it on the memory node of
+ * the thread that drives it) and shares one component registry: a component ID
+ * means the same type in every shard. Shards share nothing else, so a spatial
+ * partition of the simulation scales with the number of cores / sockets.
+ * Must not move in memory while its workers are started.
+ */
+typedef struct {
+	ArlEcsWorld* shards[ARLECS_MAX_SHARDS]; ///< The worlds, one per shard.
+	uint32_t count;                          ///< Number of shards.
+	uint32_t component_counter;              ///< Components registered in every shard.
+	ArlWorkerPool workers;                   ///< Persistent threads, one per shard (see arlecs_shards_start).
+} ArlShardedWorld;
+
+/**
+ * @brief Function run on every shard by arlecs_shards_run().
+ * @param world The shard.
+ * @param shard Index of the shard (0 .. count - 1).
+ * @param ctx User context.
+ */
+typedef void (*ArlShardFunc)(ArlEcsWorld* world, uint32_t shard, void* ctx);
+
+// --- API ---
+
+/**
+ * @brief Creates one world per arena, without memory hints.
+ * The pools go wherever the arenas are: place each arena on the node of its
+ * shard thread yourself, or use arlecs_shards_init_ex().
+ * @param sw The sharded world to initialize.
+ * @param arenas Array of count initialized arenas (one per shard).
+ * @param count Number of shards (clamped to ARLECS_MAX_SHARDS).
+ * @param max_entities Entity capacity of each shard.
+ */
+void arlecs_shards_init(ArlShardedWorld* sw, Armel* arenas, uint32_t count, uint32_t max_entities);
+
+/**
+ * @brief Same as arlecs_shards_init(), with memory hints for every shard.
+ * Each shard is created with arlecs_world_create_ex(): with ARLECS_MEM_NUMA,
+ * the pools of shard i are bound to nodes[i].
+ * @param mem_flags ARLECS_MEM_HUGEPAGES and/or ARLECS_MEM_NUMA (see arlecs_mem.h).
+ * @param nodes NUMA node of each shard (count entries), or NULL for no binding.
+ */
+void arlecs_shards_init_ex(ArlShardedWorld* sw, Armel* arenas, uint32_t count, uint32_t max_entities, uint32_t mem_flags, const int* nodes);
+
+/**
+ * @brief Starts one persistent thread per shard, pinned once to its CPU.
+ * arlecs_shards_run() then only wakes them: no thread is created per frame, and
+ * a shard keeps running on the core (and memory node) its arena was placed for.
+ * @param cpus CPU of each shard (count entries, cpus[0] for the caller is ignored), or NULL.
+ * @return The number of threads available, calling thread included.
+ */
+uint32_t arlecs_shards_start(ArlShardedWorld* sw, const int* cpus);
+
+/**
+ * @brief Stops and joins the shard threads.
+ */
+void arlecs_shards_stop(ArlShardedWorld* sw);
+
+/**
+ * @brief Registers a component type in every shard, with the same ID.
+ * Use the macro arlecs_shards_component_new() instead for type safety.
+ */
+uint32_t arlecs_shards_register_component(ArlShardedWorld* sw, size_t size);
+
+/**
+ * @brief Registers a component type with a storage descriptor (stable, hashed,
+ * aligned...) in every shard, with the same ID.
+ */
+uint32_t arlecs_shards_register_component_desc(ArlShardedWorld* sw, const ArlPoolDesc* desc);
+
+/**
+ * @brief Helper macro to register a component in all the shards.
+ */
+#define arlecs_shards_component_new(SW,TYPE) \
+	arlecs_shards_register_component(SW, sizeof(TYPE))
+
+/**
+ * @brief Moves an entity and all its components from one shard to another.
+ * The components are copied in one batch, then removed from src.
+ * The source ID is left without any component.
+ * @param src The world owning the entity.
+ * @param dst The world receiving it (same component registry).
+ * @param entity The entity in src.
+ * @return The ID of the entity in dst, or ARL_NULL_ENTITY if dst has no room
+ * for it or one of its components (src is left untouched).
+ */
+ArlEntity arlecs_migrate_entity(ArlEcsWorld* src, ArlEcsWorld* dst, ArlEntity entity);
+
+/**
+ * @brief Runs fn on every shard and waits for all of them.
+ * Each shard runs on its thread started by arlecs_shards_start() (shard 0 on the
+ * caller); without started threads, or without pthreads, shards run one after the other.
+ * Shards must not touch each other inside fn: migrate entities after the call returns.
+ */
+void arlecs_shards_run(ArlShardedWorld* sw, ArlShardFunc fn, void* ctx);
+
+#endif
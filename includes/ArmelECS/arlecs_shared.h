@@ -0,0 +1,143 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_SHARED_H
+#define ARLECS_SHARED_H
+
+#include <ArmelECS/arlecs.h>
+
+/**
+ * Shared-memory world for zero-copy external readers.
+ *
+ * The writer (game server) builds its world in a POSIX shared-memory segment
+ * (shm_open). Other processes (analytics, replay recorder) map the segment
+ * read-only and iterate the pools in place, with the usual views and getters:
+ * no serialization, no socket.
+ *
+ * Position independence : every internal reference of the world points inside
+ * the segment, and the header records the writer's mapping address. A reader
+ * keeps local copies of the world and pool headers (O(component types)) rebased
+ * on its own mapping; the sparse, dense and data arrays are read in place.
+ *
+ * Consistency : a seqlock. The writer makes the counter odd before mutating the
+ * world (arlecs_shared_begin) and even again when the frame is complete
+ * (arlecs_shared_publish). It never waits for readers. A reader brackets its
+ * reads with arlecs_shared_read_begin / arlecs_shared_read_end and drops what it
+ * read if the writer published in between (torn read).
+ *
+ * Rules :
+ * - Register components and resources between begin and publish, like any mutation.
+ * - Readers must not write through the world they get (the mapping is read-only).
+ * - Resources and component data must not hold pointers (they would be the writer's).
+ * POSIX only, arlecs_shared_create() / arlecs_shared_attach() return false elsewhere.
+ */
+
+/** Bytes reserved at the start of the segment for the header (one page). */
+#define ARLECS_SHARED_HEADER_SIZE 4096
+
+/** 'ALSH' */
+#define ARLECS_SHARED_MAGIC 0x48534C41u
+#define ARLECS_SHARED_VERSION 1
+
+/**
+ * @brief Header stored at the start of the segment.
+ */
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t world_size;      ///< sizeof(ArlEcsWorld) of the writer's build.
+	uint32_t max_components;  ///< ARLECS_MAX_COMPONENT_TYPES of that build.
+	uint64_t size;            ///< Size of the segment in bytes.
+	uint64_t base;            ///< Address of the segment in the writer process.
+	uint64_t world;           ///< World offset from the start of the segment.
+	uint64_t seq;             ///< Seqlock counter: odd while the writer mutates the world.
+	uint64_t frame;           ///< Number of frames published.
+} ArlSharedHeader;
+
+/**
+ * @brief Writer side: the segment and the world it holds.
+ */
+typedef struct {
+	Armel arena;              ///< Arena over the segment, after the header. Do not arl_free() it.
+	ArlSharedHeader* header;  ///< Start of the mapping.
+	size_t size;              ///< Size of the mapping.
+	int fd;                   ///< Shared-memory descriptor.
+	ArlEcsWorld* world;       ///< The shared world.
+	char name[64];            ///< Segment name, unlinked by arlecs_shared_destroy().
+} ArlSharedWorld;
+
+/**
+ * @brief Reader side: a read-only mapping and local, rebased copies of the headers.
+ */
+typedef struct {
+	const ArlSharedHeader* header; ///< Start of the read-only mapping.
+	size_t size;              ///< Size of the mapping.
+	int fd;                   ///< Shared-memory descriptor.
+	ArlEcsWorld world;        ///< Local copy of the world, valid after arlecs_shared_read_begin().
+	ArlPool* pools;           ///< Local copies of the pools [ARLECS_MAX_COMPONENT_TYPES].
+	uint64_t seq;             ///< Seqlock value of the current read.
+	uint64_t frame;           ///< Frame of the current read.
+} ArlSharedReader;
+
+// --- Writer API ---
+
+/**
+ * @brief Creates a shared-memory segment and a world in it.
+ * The segment starts in the "mutating" state: call arlecs_shared_publish()
+ * once the components are registered and the first frame is built.
+ * @param name Segment name ("/my_world", see shm_open), at most 63 characters.
+ * @param size Size of the segment in bytes (header included).
+ * @param max_entities Capacity of the world.
+ * @return false if the segment cannot be created or mapped, or if the name is
+ * already taken (another writer, or a segment left behind: shm_unlink() it first).
+ */
+bool arlecs_shared_create(ArlSharedWorld* sw, const char* name, size_t size, uint32_t max_entities);
+
+/**
+ * @brief Starts a frame: readers will discard anything read until the next publish.
+ */
+void arlecs_shared_begin(ArlSharedWorld* sw);
+
+/**
+ * @brief Ends a frame: the world is consistent again and visible to readers.
+ */
+void arlecs_shared_publish(ArlSharedWorld* sw);
+
+/**
+ * @brief Unmaps the segment and removes its name. Attached readers keep their mapping.
+ */
+void arlecs_shared_destroy(ArlSharedWorld* sw);
+
+// --- Reader API ---
+
+/**
+ * @brief Maps an existing segment read-only.
+ * @param name Segment name given to arlecs_shared_create().
+ * @param arena Arena for the local pool headers (ARLECS_MAX_COMPONENT_TYPES pools).
+ * @return false if the segment does not exist or was written by another build.
+ */
+bool arlecs_shared_attach(ArlSharedReader* reader, const char* name, Armel* arena);
+
+/**
+ * @brief Starts a read: copies and rebases the world and pool headers.
+ * Never waits: returns NULL if the writer is in the middle of a frame (try again later).
+ * @return A read-only world to iterate with views and getters, or NULL.
+ */
+ArlEcsWorld* arlecs_shared_read_begin(ArlSharedReader* reader);
+
+/**
+ * @brief Ends a read.
+ * @return true if the writer did not touch the world since arlecs_shared_read_begin(),
+ * false if what was read may be torn and must be discarded.
+ */
+bool arlecs_shared_read_end(const ArlSharedReader* reader);
+
+/**
+ * @brief Unmaps the segment.
+ */
+void arlecs_shared_detach(ArlSharedReader* reader);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_SNAPSHOT_H
+#define ARLECS_SNAPSHOT_H
+
+#include <ArmelECS/arlecs.h>
+
+/**
+ * Snapshots copy the address range owned by a world, from the world struct to
+ * the cursor of its arena, with a single memcpy. Internal pointers are then
+ * shifted by the copy offset: O(component types), no per-entity work.
+ *
+ * Rules for a world used with snapshots :
+ * - Create the world first in its arena and allocate nothing unrelated after it
+ *   (give scratch arenas their own Armel), every byte after it is copied.
+ * - The arena must not be chained (ARL_ALLOW_CHAIN): the range must be contiguous.
+ * - Register components before taking the first snapshot.
+ */
+
+/**
+ * Snapshots keep the same offset modulo this value (or the largest pool alignment
+ * of the world if it is larger), so aligned data stays aligned.
+ */
+#define ARLECS_SNAPSHOT_ALIGN 64
+
+/**
+ * @brief Returns the number of bytes a snapshot of this world copies.
+ */
+size_t arlecs_world_footprint(const ArlEcsWorld* world);
+
+/**
+ * @brief Copies a world into another arena.
+ * The clone is a fully usable (read and write) world, backed by dst_arena.
+ * To keep a ring of rollback states, rewind dst_arena with arl_rewind_to().
+ * @param world The world to copy.
+ * @param dst_arena The arena receiving the copy.
+ * @return The clone.
+ */
+ArlEcsWorld* arlecs_world_clone_into(ArlEcsWorld* world, Armel* dst_arena);
+
+/**
+ * @brief Restores a world to the state held by a snapshot.
+ * The world keeps its address, its arena and its bound scratch arenas.
+ * Anything allocated in the world arena after the snapshot was taken is released.
+ * @param world The live world to overwrite.
+ * @param snapshot A clone made by arlecs_world_clone_into() from this world.
+ */
+void arlecs_world_restore(ArlEcsWorld* world, const ArlEcsWorld* snapshot);
+
+#endif
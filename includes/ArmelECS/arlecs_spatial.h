@@ -0,0 +1,140 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_SPATIAL_H
+#define ARLECS_SPATIAL_H
+
+#include <ArmelECS/arlecs.h>
+#include <ArmelECS/arlecs_workers.h>
+
+/**
+ * Uniform grid spatial index over a position component.
+ *
+ * The position component must start with 2 or 3 floats (x, y [, z]).
+ * Entities are stored sorted by cell (counting sort, CSR layout): the entities
+ * of a cell are contiguous, and so are the cells of a grid row. Positions are
+ * copied next to the IDs, so a query reads two linear arrays and never touches
+ * the component pool.
+ *
+ * Incremental updates are O(1): an entity leaving the sorted part leaves a hole
+ * (ARL_NULL_ENTITY, NaN position), and added or moved entities are appended to an
+ * unsorted tail scanned by every query. Once holes + tail exceed
+ * ARLECS_SPATIAL_SLACK of the indexed entities, the grid is rebuilt.
+ *
+ * The index is derived data: it is not part of world snapshots, rebuild it after
+ * arlecs_world_restore().
+ */
+
+/** Fraction of holes + tail (relative to the indexed entities) that triggers a rebuild. */
+#define ARLECS_SPATIAL_SLACK 0.125f
+
+/** Holes + tail always tolerated, whatever the number of indexed entities. */
+#define ARLECS_SPATIAL_SLACK_MIN 64
+
+/**
+ * @brief Spatial index state. Read-only for users, except through the API.
+ */
+typedef struct {
+	ArlEcsWorld* world;
+	uint32_t component_id;  ///< Indexed position component.
+	uint32_t dims;          ///< 2 or 3.
+
+	float origin[3];        ///< Minimum corner of the grid.
+	float cell_size;        ///< Edge length of a cell.
+	float inv_cell;         ///< 1 / cell_size.
+	uint32_t cells[3];      ///< Resolution per axis (1 on unused axes).
+	uint32_t cell_count;    ///< Total number of cells.
+
+	uint32_t* cell_start;   ///< [cell_count + 2] CSR offsets, cell c is [cell_start[c], cell_start[c + 1]).
+	ArlEntity* entities;    ///< [capacity] Entities sorted by cell, then the unsorted tail.
+	float* positions;       ///< [capacity * dims] Positions in the same order.
+	uint32_t* entity_cell;  ///< [capacity] Cell of an entity (ARL_NULL_ID if not indexed).
+	uint32_t* entity_slot;  ///< [capacity] Position of an entity in 'entities'.
+
+	uint32_t count;         ///< Number of indexed entities.
+	uint32_t end;           ///< Slots in use: sorted part [0, cell_start[cell_count]), then the tail.
+	uint32_t holes;         ///< Dead slots in the sorted part (ARL_NULL_ENTITY).
+	uint32_t capacity;      ///< Maximum entities (world max_entities).
+} ArlSpatialGrid;
+
+/**
+ * @brief A run of candidates returned by a query: one grid row clipped to the query box.
+ */
+typedef struct {
+	const ArlEntity* entities; ///< First entity of the span.
+	const float* positions;    ///< Its position (dims floats per entity).
+	uint32_t count;            ///< Number of entities in the span.
+} ArlSpatialSpan;
+
+// --- API ---
+
+/**
+ * @brief Creates a grid index in the world arena.
+ * Positions outside [min, max] are clamped to the border cells.
+ * @param world The world.
+ * @param component_id Registered position component (2 or 3 leading floats).
+ * @param dims 2 or 3.
+ * @param min Minimum corner (dims floats).
+ * @param max Maximum corner (dims floats).
+ * @param cell_size Edge of a cell, typically the usual query radius.
+ * @return The index (empty, call a rebuild).
+ */
+ArlSpatialGrid* arlecs_spatial_create(ArlEcsWorld* world, uint32_t component_id, uint32_t dims,
+                                      const float* min, const float* max, float cell_size);
+
+/**
+ * @brief Rebuilds the whole index from the position pool (counting sort).
+ */
+void arlecs_spatial_rebuild(ArlSpatialGrid* grid);
+
+/**
+ * @brief Rebuilds the whole index on persistent workers (per-worker histograms, then scatter).
+ * The order inside a cell is the same as with arlecs_spatial_rebuild().
+ * Falls back to arlecs_spatial_rebuild() with a single worker, no scratch memory,
+ * or a small pool.
+ * @param workers Started worker pool (see arlecs_workers_start).
+ * @param scratch Arena for the histograms (workers * cells * 4 bytes), rewound on return.
+ * NULL uses the world frame scratch. Never the world arena: it would grow the snapshots.
+ */
+void arlecs_spatial_rebuild_parallel(ArlSpatialGrid* grid, ArlWorkerPool* workers, Armel* scratch);
+
+/**
+ * @brief Updates the index for entities whose position was added, moved or removed.
+ * O(1) per entity: a move inside its cell is written in place, otherwise the entity
+ * leaves a hole and goes to the tail. Rebuilds once holes + tail grow too large.
+ * @param changed Entities to refresh.
+ * @param n Number of entities.
+ */
+void arlecs_spatial_update(ArlSpatialGrid* grid, const ArlEntity* changed, uint32_t n);
+
+/**
+ * @brief Returns the candidate spans overlapping a box (one span per grid row,
+ * plus the unsorted tail as the last span if it is not empty).
+ * Candidates are filtered by cell only, check the positions for exact tests.
+ * Holes are ARL_NULL_ENTITY with NaN positions: they fail every comparison.
+ * @param min Minimum corner (dims floats).
+ * @param max Maximum corner (dims floats).
+ * @param spans Output spans.
+ * @param max_spans Capacity of spans.
+ * @return Number of spans found (empty rows are skipped). May exceed max_spans,
+ * only max_spans are written: call again with more room.
+ */
+uint32_t arlecs_spatial_query_aabb(const ArlSpatialGrid* grid, const float* min, const float* max,
+                                   ArlSpatialSpan* spans, uint32_t max_spans);
+
+/**
+ * @brief Collects the entities within radius of a point (exact distance test).
+ * @param center Query point (dims floats).
+ * @param radius Query radius.
+ * @param out Output entities.
+ * @param max_out Capacity of out.
+ * @return Number of entities found. May exceed max_out, only max_out are written:
+ * call again with more room.
+ */
+uint32_t arlecs_spatial_query_radius(const ArlSpatialGrid* grid, const float* center, float radius,
+                                     ArlEntity* out, uint32_t max_out);
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_STATS_H
+#define ARLECS_STATS_H
+
+#include <ArmelECS/arlecs.h>
+
+/** Size of a page used to measure the occupancy of the sparse arrays. */
+#define ARLECS_STATS_PAGE_SIZE 4096
+
+/**
+ * @brief Memory and occupancy report for one component pool.
+ */
+typedef struct {
+	uint32_t component_id;     ///< ID of the component.
+	size_t elem_size;          ///< Size of one component in bytes.
+	uint32_t count;            ///< Active components.
+	uint32_t tombstones;       ///< Dead slots waiting for compaction (stable pools).
+	uint32_t capacity;         ///< Reserved slots.
+	uint32_t index_bits;       ///< Width of the sparse entries (16 or 32).
+
+	size_t sparse_bytes;       ///< Bytes reserved by the sparse array.
+	size_t dense_bytes;        ///< Bytes reserved by the dense array.
+	size_t data_bytes;         ///< Bytes reserved by the component data.
+	size_t wasted_bytes;       ///< Reserved bytes holding nothing (free slots + tombstones + sparse beyond the peak entity).
+
+	uint32_t sparse_pages;      ///< Pages spanned by the sparse array.
+	uint32_t sparse_pages_used; ///< Pages holding at least one live entry (ARL_NULL_ID when pages_counted is false).
+	bool pages_counted;         ///< sparse_pages_used was computed (needs scratch memory).
+
+	uint64_t adds;             ///< Lifetime additions.
+	uint64_t removes;          ///< Lifetime removals.
+	uint64_t swaps;            ///< Lifetime element moves (swap & pop).
+	uint64_t touches;          ///< Lifetime in-place writes signaled (arlecs_pool_touch, systems).
+
+	uint32_t mem_flags;        ///< ARLECS_MEM_* hints accepted by the system (huge pages, NUMA).
+} ArlPoolStats;
+
+/**
+ * @brief Memory and occupancy report for a whole world.
+ */
+typedef struct {
+	uint32_t max_entities;     ///< Entity capacity of the world.
+	uint32_t created_entities; ///< Entity IDs handed out so far.
+	uint32_t live_entities;    ///< Entities owning at least one component (ARL_NULL_ID when live_counted is false).
+	bool live_counted;         ///< live_entities was computed (needs scratch memory).
+	uint32_t peak_entity_id;   ///< Highest entity ID handed out (ARL_NULL_ID if none).
+
+	size_t pools_bytes;        ///< Bytes reserved by all the pools.
+	size_t wasted_bytes;       ///< Sum of the pools wasted bytes.
+	size_t arena_used;         ///< Bytes used in the world arena (0 for a world without arena, e.g. a shared reader).
+	size_t arena_capacity;     ///< Total bytes of the world arena (idem).
+
+	uint32_t pool_count;       ///< Number of valid entries in pools.
+	ArlPoolStats pools[ARLECS_MAX_COMPONENT_TYPES];
+} ArlWorldStats;
+
+// --- API ---
+
+/**
+ * @brief Fills a report for a single pool.
+ * @param pool The pool to inspect.
+ * @param scratch Arena used for a temporary page bitmap (rewound before returning), or NULL.
+ * @param peak_entities Number of entity IDs in use (sparse entries beyond are counted as wasted).
+ * @param out Receives the report (component_id is left to 0).
+ */
+void arlecs_pool_stats(const ArlPool* pool, Armel* scratch, uint32_t peak_entities, ArlPoolStats* out);
+
+/**
+ * @brief Fills a report for the world and each of its pools.
+ * This walks every dense array: call it from tools or debug overlays, not every frame.
+ * Nothing is allocated in the world arena, which may be chained, persisted or
+ * shared (a shared reader's world has none).
+ * @param world The world to inspect.
+ * @param scratch Arena for the temporary bitmaps (rewound before returning),
+ * NULL to use world->frame_scratch. Without either, the counts needing them are ARL_NULL_ID.
+ * @param out Receives the report.
+ */
+void arlecs_world_stats(ArlEcsWorld* world, Armel* scratch, ArlWorldStats* out);
+
+/**
+ * @brief Prints a world report to stdout (one line per pool).
+ * Counts that were not computed are shown as '-'.
+ * @param stats A report filled by arlecs_world_stats().
+ */
+void arlecs_print_stats(const ArlWorldStats* stats);
+
+#endif
@@ -2,8 +2,13 @@
 #define ARLECS_SYSTEM_H
 
 #include <string.h>
+#include <time.h>
 #include <ArmelECS/arlecs.h>
 
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
 
 typedef enum {
     ARL_PHASE_STARTUP = 0,
@@ -17,21 +22,95 @@ typedef enum {
 typedef void (*ArlSystemFunc)(ArlEcsWorld* world, void* ctx);
 
 
+/** Maximum number of required components per system (see arlecs_sys_require). */
+#define ARLECS_SYS_MAX_INPUTS 8
+
+
+/**
+ * @brief Amortized iteration state of a system (see arlecs_sys_set_budget).
+ * The cursor persists between calls, so each call resumes where the previous one stopped.
+ */
+typedef struct ArlSlice {
+    uint32_t cursor;       // Position in the master pool of the sliced view
+    uint32_t budget;       // Max entities per call (0 = unlimited)
+    uint64_t budget_ns;    // Max time per call in ns (0 = unlimited)
+
+    // [Internal] per call
+    uint64_t deadline_ns;
+    uint32_t processed;
+    bool started;
+} ArlSlice;
+
+
 typedef struct {
     const char* name;      // debug / profiling
     ArlSystemFunc update;  // Function to call
     ArlSystemPhase phase;  // Phase (moment where the function will be called)
     bool active;           // Sets the system as callable or paused
+
+    uint32_t interval;     // Runs once every `interval` calls of its phase (0 or 1 = always)
+    uint32_t offset;       // Which call of the interval runs it (spreads systems sharing an interval)
+    uint32_t ticks;        // Calls of its phase seen so far
+    bool sliced;           // True if the system has a budget (slice is published in world->slice)
+    ArlSlice slice;
+
+    // Access declarations (see arlecs_sys_read / arlecs_sys_write)
+    bool declared;                 // False = unknown access, conflicts with every system
+    ArlComponentMask reads;        // Components read
+    ArlComponentMask writes;       // Components written
+    uint64_t resource_reads;       // Resources read (bit = resource ID)
+    uint64_t resource_writes;      // Resources written
+
+    // Input skipping (see arlecs_sys_require / arlecs_sys_set_reactive)
+    uint32_t inputs[ARLECS_SYS_MAX_INPUTS]; // Required components
+    uint32_t input_count;
+    bool reactive;                 // Also skipped when no input changed since its last run
+    uint64_t input_version;        // Sum of the input pool versions at the end of the last run
+
+    // Counters (see arlecs_sys_stats)
+    uint64_t runs;                 // Calls that ran the system
+    uint64_t skips_empty;          // Calls skipped because a required pool was empty
+    uint64_t skips_unchanged;      // Calls skipped because no input changed (reactive systems)
 } ArlSystem;
 
+/**
+ * @brief Totals of the system counters of a manager.
+ */
+typedef struct {
+    uint64_t runs;
+    uint64_t skips_empty;
+    uint64_t skips_unchanged;
+} ArlSystemStats;
+
 
 #define ARLECS_MAX_SYSTEMS 64
 
+/** Maximum number of per-worker scratch arenas owned by a manager. */
+#define ARLECS_MAX_WORKERS 16
+
 typedef struct {
     ArlSystem systems[ARLECS_MAX_SYSTEMS];
     uint32_t count;
+
+    // Scratch memory handed to systems (see arlecs_sys_init_scratch)
+    Armel frame_scratch;                      // Rewound after each phase
+    Armel worker_scratch[ARLECS_MAX_WORKERS]; // One per worker thread
+    uint32_t worker_count;
+    bool has_scratch;
 } ArlSystemManager;
 
+/**
+ * @brief Scratch state saved while a phase runs, so that nested phases
+ * (e.g. a MANUAL phase triggered from a system) restore the caller's arenas.
+ */
+typedef struct {
+    Armel* frame_scratch;
+    Armel* worker_scratch;
+    uint32_t worker_count;
+    uintptr_t frame_mark;
+    uintptr_t worker_marks[ARLECS_MAX_WORKERS];
+} ArlScratchScope;
+
 // ----- API -----
 
 /**
@@ -40,6 +119,81 @@ typedef struct {
  */
 static inline void arlecs_sys_init(ArlSystemManager* mgr) {
     mgr->count = 0;
+    mgr->worker_count = 0;
+    mgr->has_scratch = false;
+}
+
+
+/**
+ * @brief Gives the manager a frame scratch arena and one scratch arena per worker.
+ * The buffers are carved once from parent, no allocation happens afterwards.
+ * Systems reach them through arlecs_frame_scratch() / arlecs_worker_scratch().
+ * @param mgr 
+ * @param parent Arena providing the scratch buffers: a dedicated arena, not the world arena
+ * (snapshot restores rewind it, and the buffers would be copied into every snapshot)
+ * @param frame_size Capacity of the frame scratch arena in bytes
+ * @param workers Number of worker scratch arenas (clamped to ARLECS_MAX_WORKERS)
+ * @param worker_size Capacity of each worker scratch arena in bytes
+ */
+static inline void arlecs_sys_init_scratch (ArlSystemManager* mgr, Armel* parent, size_t frame_size, uint32_t workers, size_t worker_size) {
+    if (workers > ARLECS_MAX_WORKERS) workers = ARLECS_MAX_WORKERS;
+
+    void* frame_buf = arl_alloc(parent, frame_size);
+    arl_new_local(&mgr->frame_scratch, frame_buf, frame_size, ARL_ALIGN, ARL_NOFLAG);
+
+    for (uint32_t i = 0; i < workers; i++) {
+        void* worker_buf = arl_alloc(parent, worker_size);
+        arl_new_local(&mgr->worker_scratch[i], worker_buf, worker_size, ARL_ALIGN, ARL_NOFLAG);
+    }
+
+    mgr->worker_count = workers;
+    mgr->has_scratch = true;
+}
+
+
+/**
+ * @brief Publishes the manager scratch arenas into the world and remembers their cursors.
+ * @param mgr 
+ * @param world 
+ * @param scope Receives the previous state, to be passed to arlecs_sys_scratch_end()
+ */
+static inline void arlecs_sys_scratch_begin (ArlSystemManager* mgr, ArlEcsWorld* world, ArlScratchScope* scope) {
+    scope->frame_scratch  = world->frame_scratch;
+    scope->worker_scratch = world->worker_scratch;
+    scope->worker_count   = world->worker_count;
+    scope->frame_mark     = 0;
+
+    if (! mgr->has_scratch) return;
+
+    scope->frame_mark = arl_offset(&mgr->frame_scratch);
+    for (uint32_t i = 0; i < mgr->worker_count; i++) {
+        scope->worker_marks[i] = arl_offset(&mgr->worker_scratch[i]);
+    }
+
+    world->frame_scratch  = &mgr->frame_scratch;
+    world->worker_scratch = mgr->worker_scratch;
+    world->worker_count   = mgr->worker_count;
+}
+
+
+/**
+ * @brief Rewinds the scratch arenas to the cursors saved by arlecs_sys_scratch_begin()
+ * and restores the previous world bindings.
+ * @param mgr 
+ * @param world 
+ * @param scope 
+ */
+static inline void arlecs_sys_scratch_end (ArlSystemManager* mgr, ArlEcsWorld* world, const ArlScratchScope* scope) {
+    if (mgr->has_scratch) {
+        arl_rewind_to(&mgr->frame_scratch, scope->frame_mark);
+        for (uint32_t i = 0; i < mgr->worker_count; i++) {
+            arl_rewind_to(&mgr->worker_scratch[i], scope->worker_marks[i]);
+        }
+    }
+
+    world->frame_scratch  = scope->frame_scratch;
+    world->worker_scratch = scope->worker_scratch;
+    world->worker_count   = scope->worker_count;
 }
 
 
@@ -53,44 +207,360 @@ static inline void arlecs_sys_init(ArlSystemManager* mgr) {
  */
 static inline void arlecs_sys_register (ArlSystemManager* mgr, const char* name, ArlSystemPhase phase, ArlSystemFunc func) {
     if (mgr->count >= ARLECS_MAX_SYSTEMS) return;
-    mgr->systems[mgr->count].name   = name;
-    mgr->systems[mgr->count].update = func;
-    mgr->systems[mgr->count].phase  = phase;
-    mgr->systems[mgr->count].active = true;
+    ArlSystem* s = &mgr->systems[mgr->count];
+    memset(s, 0, sizeof(*s));
+    s->name   = name;
+    s->update = func;
+    s->phase  = phase;
+    s->active = true;
     mgr->count++;
 }
 
 
 /**
- * @brief Runs all active systems.
+ * @brief Returns the first system registered with this name, or NULL.
+ * @param mgr 
+ * @param name 
+ */
+static inline ArlSystem* arlecs_sys_find (ArlSystemManager* mgr, const char* name) {
+    for (uint32_t i = 0; i < mgr->count; i++) {
+        if (strcmp(mgr->systems[i].name, name) == 0) return &mgr->systems[i];
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief Runs the system only once every interval calls of its phase.
+ * E.g. at 60 FPS, interval 6 runs an AI system at 10 Hz.
+ * Give systems sharing an interval different offsets to spread them across frames.
+ * @param mgr 
+ * @param name 
+ * @param interval Number of calls between two runs (0 or 1 = every call)
+ * @param offset Which call of the interval runs the system (0 .. interval - 1)
+ */
+static inline void arlecs_sys_set_interval (ArlSystemManager* mgr, const char* name, uint32_t interval, uint32_t offset) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    s->interval = interval;
+    s->offset   = interval ? offset % interval : 0;
+    s->ticks    = 0;
+}
+
+
+/**
+ * @brief Gives a system a per-call budget. The system iterates its main view with
+ * arlecs_sys_slice_next() instead of arlecs_view_next(): each call processes at most
+ * max_entities entities and/or max_us microseconds, then the next call resumes there.
+ * @param mgr 
+ * @param name 
+ * @param max_entities Max entities per call (0 = unlimited)
+ * @param max_us Max time per call in microseconds (0 = unlimited)
+ */
+static inline void arlecs_sys_set_budget (ArlSystemManager* mgr, const char* name, uint32_t max_entities, uint32_t max_us) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    s->sliced = max_entities || max_us;
+    s->slice.cursor    = 0;
+    s->slice.budget    = max_entities;
+    s->slice.budget_ns = (uint64_t)max_us * 1000;
+}
+
+
+/**
+ * @brief Declares that a system reads a component.
+ * Once a system declares any access, its declarations must be complete
+ * (see arlecs_sys_conflicts).
+ * @param mgr 
+ * @param name 
+ * @param component_id 
+ */
+static inline void arlecs_sys_read (ArlSystemManager* mgr, const char* name, uint32_t component_id) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    arlecs_mask_set(&s->reads, component_id);
+    s->declared = true;
+}
+
+
+/**
+ * @brief Declares that a system writes a component (implies reading it).
+ * @param mgr 
+ * @param name 
+ * @param component_id 
+ */
+static inline void arlecs_sys_write (ArlSystemManager* mgr, const char* name, uint32_t component_id) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    arlecs_mask_set(&s->reads, component_id);
+    arlecs_mask_set(&s->writes, component_id);
+    s->declared = true;
+}
+
+
+/**
+ * @brief Declares that a system reads a world resource.
+ * @param mgr 
+ * @param name 
+ * @param resource_id 
+ */
+static inline void arlecs_sys_read_resource (ArlSystemManager* mgr, const char* name, uint32_t resource_id) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    s->resource_reads |= (uint64_t)1 << resource_id;
+    s->declared = true;
+}
+
+
+/**
+ * @brief Declares that a system writes a world resource (implies reading it).
+ * @param mgr 
+ * @param name 
+ * @param resource_id 
+ */
+static inline void arlecs_sys_write_resource (ArlSystemManager* mgr, const char* name, uint32_t resource_id) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    s->resource_reads  |= (uint64_t)1 << resource_id;
+    s->resource_writes |= (uint64_t)1 << resource_id;
+    s->declared = true;
+}
+
+
+/**
+ * @brief Declares a component the system needs: the system is skipped while the
+ * pool of any required component is empty (e.g. no projectile, no collision pass).
+ * @param mgr 
+ * @param name 
+ * @param component_id 
+ */
+static inline void arlecs_sys_require (ArlSystemManager* mgr, const char* name, uint32_t component_id) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s || s->input_count >= ARLECS_SYS_MAX_INPUTS) return;
+    for (uint32_t i = 0; i < s->input_count; i++) {
+        if (s->inputs[i] == component_id) return;
+    }
+    s->inputs[s->input_count++] = component_id;
+}
+
+
+/**
+ * @brief Makes a system reactive: it is also skipped when none of its required
+ * pools changed since the end of its last run (arlecs_pool_version).
+ * Only for systems whose output depends on their inputs alone, not on time:
+ * an integrator (pos += vel * dt) must not be reactive.
+ * In-place writes are seen if they are declared (arlecs_sys_write) or signaled
+ * (arlecs_pool_touch).
+ * @param mgr 
+ * @param name 
+ * @param reactive 
+ */
+static inline void arlecs_sys_set_reactive (ArlSystemManager* mgr, const char* name, bool reactive) {
+    ArlSystem* s = arlecs_sys_find(mgr, name);
+    if (! s) return;
+    s->reactive = reactive;
+}
+
+
+/**
+ * @brief Checks if two systems may not run at the same time.
+ * They conflict when one writes a component or a resource the other one reads or writes.
+ * A system without declarations conflicts with every system.
+ * @return true if the systems must be serialized.
+ */
+static inline bool arlecs_sys_conflicts (const ArlSystem* a, const ArlSystem* b) {
+    if (! a->declared || ! b->declared) return true;
+
+    if (arlecs_mask_intersects(&a->writes, &b->reads)) return true;
+    if (arlecs_mask_intersects(&b->writes, &a->reads)) return true;
+
+    return ((a->resource_writes & b->resource_reads) | (b->resource_writes & a->resource_reads)) != 0;
+}
+
+
+/**
+ * @brief Monotonic clock in nanoseconds (time budgets).
+ */
+static inline uint64_t arlecs_sys_now_ns (void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+
+/** Entities processed between two clock reads when a time budget is set. */
+#define ARLECS_SLICE_CLOCK_STRIDE 32
+
+/**
+ * @brief Budgeted version of arlecs_view_next(), for systems with a budget.
+ * Resumes the view where the previous call of the system stopped, and stops
+ * when the budget is spent. Outside of a sliced system, same as arlecs_view_next().
+ * Use it for a single view per system.
+ * @param world 
+ * @param view 
+ * @return true if a match was found, false when the budget is spent or the pass is over.
+ */
+static inline bool arlecs_sys_slice_next (ArlEcsWorld* world, ArlView* view) {
+    ArlSlice* s = world->slice;
+    if (! s) return arlecs_view_next(view);
+
+    if (! s->started) {
+        ArlPool* master = view->pools[0];
+        view->current_index = (master && s->cursor < master->count) ? s->cursor : 0;
+        s->started = true;
+    }
+
+    bool spent = s->budget && s->processed >= s->budget;
+    if (! spent && s->budget_ns && s->processed && (s->processed % ARLECS_SLICE_CLOCK_STRIDE) == 0) {
+        spent = arlecs_sys_now_ns() >= s->deadline_ns;
+    }
+
+    if (spent) {
+        s->cursor = view->current_index; // Next call resumes here
+        return false;
+    }
+
+    if (! arlecs_view_next(view)) {
+        s->cursor = 0; // Full pass done, next call starts over
+        return false;
+    }
+
+    s->processed++;
+    return true;
+}
+
+
+/**
+ * @brief Internal: sum of the versions of the required pools.
+ * @return false if a required pool is missing or empty.
+ */
+static inline bool arlecs_sys_inputs_version (const ArlSystem* s, const ArlEcsWorld* world, uint64_t* version) {
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < s->input_count; i++) {
+        uint32_t id = s->inputs[i];
+        const ArlPool* pool = id < ARLECS_MAX_COMPONENT_TYPES ? world->pools[id] : NULL;
+        if (! pool || arlecs_pool_size(pool) == 0) return false;
+        sum += arlecs_pool_version(pool);
+    }
+    *version = sum;
+    return true;
+}
+
+
+/**
+ * @brief Internal: runs one system if its interval and its inputs allow it, with its slice published.
+ */
+static inline void arlecs_sys_invoke (ArlSystem* s, ArlEcsWorld* world, void* ctx) {
+    if (s->interval > 1) {
+        uint32_t tick = s->ticks++ % s->interval;
+        if (tick != s->offset) return;
+    }
+
+    // Versions only grow: an unchanged sum means no required pool changed
+    if (s->input_count) {
+        uint64_t version;
+        if (! arlecs_sys_inputs_version(s, world, &version)) {
+            s->skips_empty++;
+            return;
+        }
+        // A sliced pass cut by its budget is not finished: it resumes whatever the version
+        bool resuming = s->sliced && s->slice.cursor != 0;
+        if (s->reactive && s->runs && ! resuming && version == s->input_version) {
+            s->skips_unchanged++;
+            return;
+        }
+    }
+
+    if (! s->sliced) {
+        s->update(world, ctx);
+    } else {
+        struct ArlSlice* previous = world->slice;
+        s->slice.started   = false;
+        s->slice.processed = 0;
+        s->slice.deadline_ns = s->slice.budget_ns ? arlecs_sys_now_ns() + s->slice.budget_ns : 0;
+
+        world->slice = &s->slice;
+        s->update(world, ctx);
+        world->slice = previous;
+    }
+    s->runs++;
+
+    // Declared writes count as changes for the other systems
+    if (s->declared) {
+        for (uint32_t id = arlecs_mask_next(&s->writes, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(&s->writes, id + 1)) {
+            if (world->pools[id]) arlecs_pool_touch(world->pools[id]);
+        }
+    }
+
+    // Own changes included: a reactive system does not wake itself up
+    if (s->input_count && ! arlecs_sys_inputs_version(s, world, &s->input_version)) s->input_version = 0;
+}
+
+
+/**
+ * @brief Runs all active systems. The scratch arenas are rewound afterwards.
  * @param mgr 
  * @param world 
  * @param ctx 
  */
 static inline void arlecs_sys_run_all (ArlSystemManager* mgr, ArlEcsWorld* world, void* ctx) {
+    ArlScratchScope scope;
+    arlecs_sys_scratch_begin(mgr, world, &scope);
+
     for (uint32_t i = 0; i < mgr->count; i++) {
         ArlSystem* s = &mgr->systems[i];
         if (s->active) {
-            s->update(world, ctx);
+            arlecs_sys_invoke(s, world, ctx);
         }
     }
+
+    arlecs_sys_scratch_end(mgr, world, &scope);
 }
 
 
 /**
  * @brief Runs the system belonging to the phase phase.
+ * The scratch arenas are rewound at the end of the phase.
  * @param mgr 
  * @param world 
  * @param phase 
  * @param ctx 
  */
 static inline void arlecs_sys_run_phase (ArlSystemManager* mgr, ArlEcsWorld* world, ArlSystemPhase phase, void* ctx) {
+    ArlScratchScope scope;
+    arlecs_sys_scratch_begin(mgr, world, &scope);
+
     for (uint32_t i = 0; i < mgr->count; i++) {
         ArlSystem* s = &mgr->systems[i];
         if (s->phase == phase && s->active) {
-            s->update(world, ctx);
+            arlecs_sys_invoke(s, world, ctx);
         }
     }
+
+    // Everything allocated by the systems of this phase is released here
+    arlecs_sys_scratch_end(mgr, world, &scope);
+}
+
+
+/**
+ * @brief Sums the run and skip counters of all the systems.
+ * @param mgr 
+ * @param out 
+ */
+static inline void arlecs_sys_stats (const ArlSystemManager* mgr, ArlSystemStats* out) {
+    memset(out, 0, sizeof(*out));
+    for (uint32_t i = 0; i < mgr->count; i++) {
+        out->runs            += mgr->systems[i].runs;
+        out->skips_empty     += mgr->systems[i].skips_empty;
+        out->skips_unchanged += mgr->systems[i].skips_unchanged;
+    }
 }
 
 
@@ -0,0 +1,158 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_TYPED_H
+#define ARLECS_TYPED_H
+
+#include <ArmelECS/arlecs.h>
+
+/*
+ * Type-specialized accessors and views, generated by macros.
+ *
+ * The generic API (arlecs_view, arlecs_get_component...) works on void* and
+ * multiplies by a runtime elem_size. The macros below generate one struct and
+ * one set of inline functions per component combination: the pool count and
+ * the element sizes are compile-time constants, so the compiler fully unrolls
+ * the membership checks and the address computation.
+ *
+ * Usage :
+ * ARL_COMPONENT_DECLARE(Position)          // Position_get / Position_add
+ * ARL_VIEW_DECLARE(PhysView, Velocity, Position)
+ *
+ * PhysView v = PhysView_begin(world, C_VEL, C_POS);
+ * while (PhysView_next(&v)) {
+ *     v.c1->x += v.c0->vx;                 // c0 : Velocity*, c1 : Position*
+ * }
+ */
+
+/**
+ * @brief Internal: fetches a pool for typed access and checks the type size.
+ * @return The pool, or NULL if the ID is unknown.
+ */
+static inline ArlPool* arlecs_typed_pool(ArlEcsWorld* world, uint32_t component_id, size_t size) {
+	if (component_id >= ARLECS_MAX_COMPONENT_TYPES) return NULL;
+
+	ArlPool* pool = world->pools[component_id];
+	assert((! pool || pool->elem_size == size) && "ArlECS Error: Typed access with the wrong component type");
+	(void)size;
+
+	return pool;
+}
+
+/**
+ * @brief Generates typed accessors for a component type T :
+ * T* T_get(world, entity, component_id) and T* T_add(world, entity, component_id).
+ */
+#define ARL_COMPONENT_DECLARE(T)                                                               \
+	static inline T* T##_get(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {    \
+		ArlPool* pool = arlecs_typed_pool(world, component_id, sizeof(T));                     \
+		if (! pool) return NULL;                                                               \
+		uint32_t index = arlecs_pool_index(pool, entity);                                      \
+		return index == ARL_NULL_ID ? NULL : (T*)pool->data + index;                           \
+	}                                                                                          \
+	static inline T* T##_add(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {    \
+		ArlPool* pool = arlecs_typed_pool(world, component_id, sizeof(T));                     \
+		assert(pool != NULL && "ArlEcs Error: Unknown component");                             \
+		return (T*)arlecs_add_component(world, entity, component_id);                          \
+	}
+
+/**
+ * @brief Generates a typed view NAME over 1 to 4 component types.
+ * * The first type drives the iteration (put the rarest component first).
+ * Generated API :
+ * - NAME NAME_begin(world, id0, id1, ...) : one component ID per type, in order.
+ * - bool NAME_next(NAME* view) : advances to the next match.
+ * - Outputs : view.entity and view.c0, view.c1... typed pointers.
+ */
+#define ARL_VIEW_DECLARE(NAME, ...) \
+	ARL__VIEW_PICK(__VA_ARGS__, ARL__VIEW4, ARL__VIEW3, ARL__VIEW2, ARL__VIEW1, ~)(NAME, __VA_ARGS__)
+
+// --- Internal generators ---
+
+#define ARL__VIEW_PICK(_1, _2, _3, _4, MACRO, ...) MACRO
+
+#define ARL__VSLOT_DECL(T, K)  ArlPool* pool##K; T* c##K;
+#define ARL__VSLOT_INIT(T, K)  v.pool##K = arlecs_typed_pool(world, id##K, sizeof(T));
+#define ARL__VSLOT_PROBE(K)    uint32_t i##K = arlecs_pool_index(v->pool##K, e); if (i##K == ARL_NULL_ID) continue;
+#define ARL__VSLOT_OUT(T, K)   v->c##K = (T*)v->pool##K->data + i##K;
+
+#define ARL__VIEW_STATE  uint32_t index; bool valid; ArlEntity entity;
+
+#define ARL__VIEW_LOOP(PROBES, OUTPUTS)                                 \
+	if (! v->valid) return false;                                       \
+	ArlPool* master = v->pool0;                                         \
+	while (v->index < master->count) {                                  \
+		if (master->tombstones) {                                       \
+			v->index = arlecs_pool_next_live(master, v->index);         \
+			if (v->index >= master->count) break;                       \
+		}                                                               \
+		uint32_t i0 = v->index++;                                       \
+		ArlEntity e = master->dense[i0];                                \
+		PROBES                                                          \
+		v->entity = e;                                                  \
+		OUTPUTS                                                         \
+		return true;                                                    \
+	}                                                                   \
+	return false;
+
+#define ARL__VIEW1(NAME, A)                                                                         \
+	typedef struct { ARL__VSLOT_DECL(A, 0) ARL__VIEW_STATE } NAME;                                 \
+	static inline NAME NAME##_begin(ArlEcsWorld* world, uint32_t id0) {                             \
+		NAME v; v.index = 0; v.entity = ARL_NULL_ENTITY;                                            \
+		ARL__VSLOT_INIT(A, 0)                                                                       \
+		v.valid = v.pool0 != NULL;                                                                  \
+		return v;                                                                                   \
+	}                                                                                               \
+	static inline bool NAME##_next(NAME* v) {                                                       \
+		ARL__VIEW_LOOP(, ARL__VSLOT_OUT(A, 0))                                                      \
+	}
+
+#define ARL__VIEW2(NAME, A, B)                                                                      \
+	typedef struct { ARL__VSLOT_DECL(A, 0) ARL__VSLOT_DECL(B, 1) ARL__VIEW_STATE } NAME;           \
+	static inline NAME NAME##_begin(ArlEcsWorld* world, uint32_t id0, uint32_t id1) {               \
+		NAME v; v.index = 0; v.entity = ARL_NULL_ENTITY;                                            \
+		ARL__VSLOT_INIT(A, 0) ARL__VSLOT_INIT(B, 1)                                                 \
+		v.valid = v.pool0 && v.pool1;                                                               \
+		return v;                                                                                   \
+	}                                                                                               \
+	static inline bool NAME##_next(NAME* v) {                                                       \
+		ARL__VIEW_LOOP(ARL__VSLOT_PROBE(1),                                                         \
+			ARL__VSLOT_OUT(A, 0) ARL__VSLOT_OUT(B, 1))                                              \
+	}
+
+#define ARL__VIEW3(NAME, A, B, C)                                                                   \
+	typedef struct {                                                                                \
+		ARL__VSLOT_DECL(A, 0) ARL__VSLOT_DECL(B, 1) ARL__VSLOT_DECL(C, 2) ARL__VIEW_STATE           \
+	} NAME;                                                                                         \
+	static inline NAME NAME##_begin(ArlEcsWorld* world, uint32_t id0, uint32_t id1, uint32_t id2) { \
+		NAME v; v.index = 0; v.entity = ARL_NULL_ENTITY;                                            \
+		ARL__VSLOT_INIT(A, 0) ARL__VSLOT_INIT(B, 1) ARL__VSLOT_INIT(C, 2)                           \
+		v.valid = v.pool0 && v.pool1 && v.pool2;                                                    \
+		return v;                                                                                   \
+	}                                                                                               \
+	static inline bool NAME##_next(NAME* v) {                                                       \
+		ARL__VIEW_LOOP(ARL__VSLOT_PROBE(1) ARL__VSLOT_PROBE(2),                                     \
+			ARL__VSLOT_OUT(A, 0) ARL__VSLOT_OUT(B, 1) ARL__VSLOT_OUT(C, 2))                         \
+	}
+
+#define ARL__VIEW4(NAME, A, B, C, D)                                                                \
+	typedef struct {                                                                                \
+		ARL__VSLOT_DECL(A, 0) ARL__VSLOT_DECL(B, 1) ARL__VSLOT_DECL(C, 2) ARL__VSLOT_DECL(D, 3)     \
+		ARL__VIEW_STATE                                                                             \
+	} NAME;                                                                                         \
+	static inline NAME NAME##_begin(ArlEcsWorld* world,                                             \
+			uint32_t id0, uint32_t id1, uint32_t id2, uint32_t id3) {                               \
+		NAME v; v.index = 0; v.entity = ARL_NULL_ENTITY;                                            \
+		ARL__VSLOT_INIT(A, 0) ARL__VSLOT_INIT(B, 1) ARL__VSLOT_INIT(C, 2) ARL__VSLOT_INIT(D, 3)     \
+		v.valid = v.pool0 && v.pool1 && v.pool2 && v.pool3;                                         \
+		return v;                                                                                   \
+	}                                                                                               \
+	static inline bool NAME##_next(NAME* v) {                                                       \
+		ARL__VIEW_LOOP(ARL__VSLOT_PROBE(1) ARL__VSLOT_PROBE(2) ARL__VSLOT_PROBE(3),                 \
+			ARL__VSLOT_OUT(A, 0) ARL__VSLOT_OUT(B, 1) ARL__VSLOT_OUT(C, 2) ARL__VSLOT_OUT(D, 3))    \
+	}
+
+#endif
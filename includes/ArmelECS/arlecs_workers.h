@@ -0,0 +1,90 @@
+/*
+ * ArlECS - A lightweight ECS based on Armel allocator.
+ * Copyright (c) 2025 Vincent Huster
+ * Licensed under the zlib License (see LICENSE file).
+ */
+
+#ifndef ARLECS_WORKERS_H
+#define ARLECS_WORKERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef _WIN32
+	#include <pthread.h>
+#endif
+
+/**
+ * Persistent worker threads.
+ *
+ * Threads are created once (optionally pinned to a CPU each) and woken for every
+ * arlecs_workers_run() call: no thread creation per frame, and a worker keeps
+ * running on the same core, close to the memory it touched last time.
+ * Worker 0 is the calling thread. Without pthreads, everything runs on the caller.
+ */
+
+/** Maximum number of worker threads (calling thread included). */
+#define ARLECS_MAX_WORKER_THREADS 16
+
+/**
+ * @brief Function run by every worker.
+ * @param worker Index of the worker (0 .. count - 1, 0 is the calling thread).
+ * @param ctx User context.
+ */
+typedef void (*ArlWorkerFunc)(uint32_t worker, void* ctx);
+
+struct ArlWorkerPool;
+
+/**
+ * @brief Internal: argument of a worker thread.
+ */
+typedef struct {
+	struct ArlWorkerPool* pool;
+	uint32_t index;
+} ArlWorkerSlot;
+
+/**
+ * @brief Worker pool. Must not move in memory while started.
+ */
+typedef struct ArlWorkerPool {
+	uint32_t count;            ///< Workers available, calling thread included.
+
+	ArlWorkerFunc fn;          ///< Function of the current run.
+	void* ctx;                 ///< Its context.
+	uint64_t generation;       ///< Incremented for each run, wakes the workers.
+	uint32_t pending;          ///< Workers still running the current call.
+	bool stop;
+
+#ifndef _WIN32
+	pthread_t threads[ARLECS_MAX_WORKER_THREADS];
+	ArlWorkerSlot slots[ARLECS_MAX_WORKER_THREADS];
+	pthread_mutex_t lock;
+	pthread_cond_t wake;       ///< Signaled when a run starts (or on stop).
+	pthread_cond_t done;       ///< Signaled when the last worker finishes.
+	bool started;
+#endif
+} ArlWorkerPool;
+
+// --- API ---
+
+/**
+ * @brief Starts count - 1 threads (the caller is worker 0).
+ * If a thread cannot be created, the pool keeps the workers started so far.
+ * @param count Number of workers (clamped to 1 .. ARLECS_MAX_WORKER_THREADS).
+ * @param cpus CPU of each worker (count entries, cpus[0] for the caller is ignored), or NULL.
+ * Pinning is best effort (Linux only).
+ * @return The number of workers available.
+ */
+uint32_t arlecs_workers_start(ArlWorkerPool* wp, uint32_t count, const int* cpus);
+
+/**
+ * @brief Runs fn on every worker and waits for all of them.
+ */
+void arlecs_workers_run(ArlWorkerPool* wp, ArlWorkerFunc fn, void* ctx);
+
+/**
+ * @brief Stops and joins the threads.
+ */
+void arlecs_workers_stop(ArlWorkerPool* wp);
+
+#endif
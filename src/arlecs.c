@@ -1,35 +1,147 @@
 #include <ArmelECS/arlecs.h>
+#include <ArmelECS/arlecs_atomic.h>
 
 
 ArlEcsWorld* arlecs_world_create(Armel* armel, uint32_t max_entities) {
+#ifdef ARLECS_COMPACT_ENTITY
+	// 0xFFFF est réservé (ARL_NULL_ENTITY)
+	assert(max_entities <= 0xFFFF && "ArlECS Error: Compact entities are limited to 65535 per world");
+#endif
 	ArlEcsWorld* w = arl_make(armel, ArlEcsWorld);
 
 	w->arena = armel;
 	w->entity_counter = 0;
 	w->max_entities = max_entities;
 	w->component_counter = 0;
+	w->resource_counter = 0;
+
+	w->mem_flags = 0;
+	w->numa_node = -1;
+
+	w->frame_scratch  = NULL;
+	w->worker_scratch = NULL;
+	w->worker_count   = 0;
+	w->slice          = NULL;
+
+	w->footprint = 0;
+	w->max_align = 0;
+
+	w->transient_base    = max_entities;
+	w->transient_counter = max_entities;
 
 	for (int i = 0; i < ARLECS_MAX_COMPONENT_TYPES; i++) {
 		w->pools[i] = NULL;
 	}
 
+	for (int i = 0; i < ARLECS_MAX_RESOURCES; i++) {
+		w->resources[i] = NULL;
+	}
+
+	return w;
+}
+
+
+ArlEcsWorld* arlecs_world_create_ex(Armel* armel, uint32_t max_entities, uint32_t mem_flags, int numa_node) {
+	ArlEcsWorld* w = arlecs_world_create(armel, max_entities);
+
+	w->mem_flags = mem_flags;
+	w->numa_node = numa_node;
+
 	return w;
 }
 
 
 ArlEntity arlecs_create_entity(ArlEcsWorld* world) {
+	assert(world->entity_counter < world->transient_base && "ArlECS Error: Too many entities");
 	return world->entity_counter++;
 }
 
 
+ArlEntity arlecs_create_entity_atomic(ArlEcsWorld* world) {
+	return arlecs_reserve_entities(world, 1);
+}
+
+
+ArlEntity arlecs_reserve_entities(ArlEcsWorld* world, uint32_t count) {
+	// CAS plutôt que fetch-add : un monde plein ne doit jamais dépasser sa capacité
+	for (;;) {
+		uint32_t first = ARL_ATOMIC_LOAD_U32(&world->entity_counter);
+		if (first > world->transient_base || count > world->transient_base - first) return ARL_NULL_ENTITY;
+
+		if (ARL_ATOMIC_CAS_U32(&world->entity_counter, first, first + count)) return first;
+	}
+}
+
+
+void arlecs_world_reserve_transients(ArlEcsWorld* world, uint32_t count) {
+	assert(count <= world->max_entities && world->entity_counter <= world->max_entities - count
+		&& "ArlECS Error: Transient range overlaps existing entities");
+
+	arlecs_expire_transients(world);
+	world->transient_base    = world->max_entities - count;
+	world->transient_counter = world->transient_base;
+}
+
+
+ArlEntity arlecs_create_transient(ArlEcsWorld* world) {
+	assert(world->transient_counter < world->max_entities && "ArlECS Error: Too many transient entities");
+	return world->transient_counter++;
+}
+
+
+void arlecs_expire_transients(ArlEcsWorld* world) {
+	uint32_t used = world->transient_counter - world->transient_base;
+
+	for (uint32_t i = 0; i < world->component_counter; i++) {
+		ArlPool* pool = world->pools[i];
+		if (pool && pool->transient_count) arlecs_pool_expire_transients(pool, world->transient_base, used);
+	}
+
+	world->transient_counter = world->transient_base;
+}
+
+
 uint32_t arlecs_register_component(ArlEcsWorld* world, size_t size) {
+	ArlPoolDesc desc = { size, ARLECS_POOL_DEFAULT, 0.0f, 0, 0 };
+	return arlecs_register_component_desc(world, &desc);
+}
+
+
+uint32_t arlecs_register_component_aligned(ArlEcsWorld* world, size_t size, size_t align) {
+	ArlPoolDesc desc = { size, ARLECS_POOL_PADDED, 0.0f, align, 0 };
+	return arlecs_register_component_desc(world, &desc);
+}
+
+
+uint32_t arlecs_register_component_hashed(ArlEcsWorld* world, size_t size, uint32_t max_count) {
+	ArlPoolDesc desc = { size, ARLECS_POOL_HASHED, 0.0f, 0, max_count };
+	return arlecs_register_component_desc(world, &desc);
+}
+
+
+uint32_t arlecs_register_component_desc(ArlEcsWorld* world, const ArlPoolDesc* desc) {
 	assert(world->component_counter < ARLECS_MAX_COMPONENT_TYPES && "ArlECS Error: Component ID out of bounds");
 
 	uint32_t new_id = world->component_counter;
 
-	world->pools[new_id] = arlecs_pool_new(world->arena, size, world->max_entities);
+	world->pools[new_id] = arlecs_pool_new_ex(world->arena, desc, world->max_entities, world->mem_flags, world->numa_node);
 	world->component_counter++;
 
+	// Un clone doit garder le décalage modulo le plus grand alignement de ses pools
+	if (world->pools[new_id]->align > world->max_align) world->max_align = world->pools[new_id]->align;
+
+	return new_id;
+}
+
+
+uint32_t arlecs_register_resource(ArlEcsWorld* world, size_t size) {
+	assert(world->resource_counter < ARLECS_MAX_RESOURCES && "ArlECS Error: Resource ID out of bounds");
+
+	uint32_t new_id = world->resource_counter;
+
+	world->resources[new_id] = arl_alloc_zeroed(world->arena, size);
+	world->resource_counter++;
+
 	return new_id;
 }
 
@@ -37,15 +149,29 @@ uint32_t arlecs_register_component(ArlEcsWorld* world, size_t size) {
 // Ajoute un composant à une entité
 void* arlecs_add_component(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {
 	assert(world->pools[component_id] != NULL && "ArlEcs Error: Unknown component");
-	assert(entity < world->entity_counter && "ArlEcs Error: Unknown entity");
 
+	if (entity >= world->transient_base) {
+		assert(entity < world->transient_counter && "ArlEcs Error: Unknown entity");
+		return arlecs_pool_add_transient(world->pools[component_id], entity);
+	}
+
+	assert(entity < world->entity_counter && "ArlEcs Error: Unknown entity");
 	return arlecs_pool_add(world->pools[component_id], entity);
 }
 
 
+// Ajout concurrent (plusieurs threads, entités distinctes)
+void* arlecs_add_component_concurrent(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {
+	assert(world->pools[component_id] != NULL && "ArlEcs Error: Unknown component");
+	assert(entity < ARL_ATOMIC_LOAD_U32(&world->entity_counter) && "ArlEcs Error: Unknown entity");
+
+	return arlecs_pool_add_concurrent(world->pools[component_id], entity);
+}
+
+
 // Récupère un composant
 void* arlecs_get_component(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {
-	assert(entity <= world->entity_counter && "ArlEcs Error: Unknown entity");
+	assert((entity <= world->entity_counter || entity >= world->transient_base) && "ArlEcs Error: Unknown entity");
 
 	if (component_id >= ARLECS_MAX_COMPONENT_TYPES) return NULL;
 
@@ -60,7 +186,67 @@ void* arlecs_get_component(ArlEcsWorld* world, ArlEntity entity, uint32_t compon
 void arlecs_remove_component(ArlEcsWorld* world, ArlEntity entity, uint32_t component_id) {
 	if (component_id >= ARLECS_MAX_COMPONENT_TYPES) return;
 
-	assert(entity <= world->entity_counter && "ArlEcs Error: Unknown entity");
+	assert((entity <= world->entity_counter || entity >= world->transient_base) && "ArlEcs Error: Unknown entity");
 	ArlPool* pool = world->pools[component_id];
 	if (pool) arlecs_pool_remove(world->pools[component_id], entity);
+}
+
+
+uint32_t arlecs_remove_components_batch(ArlEcsWorld* world, uint32_t component_id, const ArlEntity* entities, uint32_t count) {
+	if (component_id >= ARLECS_MAX_COMPONENT_TYPES) return 0;
+
+	ArlPool* pool = world->pools[component_id];
+	return pool ? arlecs_pool_remove_batch(pool, entities, count) : 0;
+}
+
+
+// Compacte les pools stables trop troués
+uint32_t arlecs_world_compact(ArlEcsWorld* world) {
+	uint32_t compacted = 0;
+
+	for (uint32_t i = 0; i < world->component_counter; i++) {
+		ArlPool* pool = world->pools[i];
+		if (pool && arlecs_pool_needs_compaction(pool)) {
+			arlecs_pool_compact(pool);
+			compacted++;
+		}
+	}
+
+	return compacted;
+}
+
+
+// Recale les pointeurs internes d'un monde copié ailleurs en mémoire
+void arlecs_world_relocate(ArlEcsWorld* world, uintptr_t lo, uintptr_t hi, intptr_t delta) {
+	for (uint32_t i = 0; i < world->component_counter; i++) {
+		if (! world->pools[i]) continue;
+
+		world->pools[i] = (ArlPool*)arl_relocate_ptr(world->pools[i], lo, hi, delta);
+		arlecs_pool_relocate(world->pools[i], lo, hi, delta);
+	}
+
+	for (uint32_t i = 0; i < world->resource_counter; i++) {
+		world->resources[i] = arl_relocate_ptr(world->resources[i], lo, hi, delta);
+	}
+}
+
+
+// Construit le masque des composants d'une entité
+void arlecs_entity_mask(ArlEcsWorld* world, ArlEntity entity, ArlComponentMask* out) {
+	arlecs_mask_clear(out);
+
+	for (uint32_t id = 0; id < world->component_counter; id++) {
+		ArlPool* pool = world->pools[id];
+		if (pool && arlecs_pool_has(pool, entity)) arlecs_mask_set(out, id);
+	}
+}
+
+
+// Vérifie que l'entité possède tous les composants du masque
+bool arlecs_has_components(ArlEcsWorld* world, ArlEntity entity, const ArlComponentMask* mask) {
+	for (uint32_t id = arlecs_mask_next(mask, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(mask, id + 1)) {
+		ArlPool* pool = world->pools[id];
+		if (! pool || ! arlecs_pool_has(pool, entity)) return false;
+	}
+	return true;
 }
\ No newline at end of file
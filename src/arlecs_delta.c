@@ -0,0 +1,167 @@
+#include <ArmelECS/arlecs_delta.h>
+
+
+// Réécrit un uint32 déjà émis (compteurs connus après le parcours)
+static void patch_u32(ArlByteStream* out, size_t at, uint32_t value) {
+	if (! out->overflow) memcpy(out->data + at, &value, sizeof(value));
+}
+
+
+// Un bloc est identique si les deux dense (et éventuellement les data) le sont
+static inline bool same_block(const ArlPool* a, const ArlPool* b, uint32_t i, uint32_t n, bool with_data) {
+	if (memcmp(a->dense + i, b->dense + i, n * sizeof(ArlEntity)) != 0) return false;
+	if (! with_data) return true;
+	return memcmp(a->data + (size_t)i * a->elem_size, b->data + (size_t)i * b->elem_size, n * a->elem_size) == 0;
+}
+
+
+// Encode les différences d'une colonne. Renvoie true si quelque chose a été écrit.
+static bool diff_pool(uint32_t id, const ArlPool* pa, const ArlPool* pb, ArlByteStream* out) {
+	size_t header = out->size;
+	uint32_t removed = 0, upserts = 0;
+
+	arlecs_stream_write_u32(out, id);
+	arlecs_stream_write_u32(out, (uint32_t)pb->elem_size);
+	arlecs_stream_write_u32(out, 0);
+	arlecs_stream_write_u32(out, 0);
+
+	// Zone où les deux colonnes peuvent être comparées bloc à bloc
+	uint32_t common = ! pa ? 0 : (pa->count < pb->count ? pa->count : pb->count);
+	const uint32_t block = ARLECS_DELTA_BLOCK;
+
+	// 1. Suppressions : présents dans a, absents de b
+	if (pa) {
+		uint32_t i = 0;
+		while (i < pa->count) {
+			if (i + block <= common && same_block(pa, pb, i, block, false)) {
+				i += block;
+				continue;
+			}
+			ArlEntity e = pa->dense[i++];
+			if (e != ARL_NULL_ENTITY && ! arlecs_pool_has((ArlPool*)pb, e)) {
+				arlecs_stream_write_u32(out, (uint32_t)e);
+				removed++;
+			}
+		}
+	}
+
+	// 2. Ajouts et modifications : présents dans b, absents ou différents dans a
+	uint32_t i = 0;
+	while (i < pb->count) {
+		if (i + block <= common && same_block(pa, pb, i, block, true)) {
+			i += block;
+			continue;
+		}
+		ArlEntity e = pb->dense[i];
+		const uint8_t* data_b = pb->data + (size_t)i * pb->elem_size;
+		i++;
+		if (e == ARL_NULL_ENTITY) continue; // Tombe d'un pool stable
+
+		uint32_t ia = pa ? arlecs_pool_index(pa, e) : ARL_NULL_ID;
+
+		if (ia != ARL_NULL_ID && memcmp(pa->data + (size_t)ia * pa->elem_size, data_b, pb->elem_size) == 0) continue;
+
+		arlecs_stream_write_u32(out, (uint32_t)e);
+		arlecs_stream_write(out, data_b, pb->elem_size);
+		upserts++;
+	}
+
+	if (removed == 0 && upserts == 0) {
+		out->size = header; // Rien à signaler pour cette colonne
+		return false;
+	}
+
+	patch_u32(out, header + 2 * sizeof(uint32_t), removed);
+	patch_u32(out, header + 3 * sizeof(uint32_t), upserts);
+	return true;
+}
+
+
+bool arlecs_world_diff(ArlEcsWorld* a, ArlEcsWorld* b, ArlByteStream* out) {
+	assert(a->component_counter <= b->component_counter && "ArlECS Error: Diff between unrelated worlds");
+
+	size_t header = out->size;
+	uint32_t pool_count = 0;
+
+	arlecs_stream_write_u32(out, ARLECS_DELTA_MAGIC);
+	arlecs_stream_write_u32(out, b->entity_counter);
+	arlecs_stream_write_u32(out, 0);
+
+	for (uint32_t id = 0; id < b->component_counter; id++) {
+		ArlPool* pb = b->pools[id];
+		if (! pb) continue;
+
+		ArlPool* pa = id < a->component_counter ? a->pools[id] : NULL;
+		assert((! pa || pa->elem_size == pb->elem_size) && "ArlECS Error: Diff between unrelated worlds");
+
+		pool_count += diff_pool(id, pa, pb, out);
+	}
+
+	patch_u32(out, header + 2 * sizeof(uint32_t), pool_count);
+	return ! out->overflow;
+}
+
+
+// Lecteur borné : toute lecture hors du buffer invalide le delta
+typedef struct {
+	const uint8_t* data;
+	size_t size;
+	size_t pos;
+} DeltaReader;
+
+static inline bool read_u32(DeltaReader* r, uint32_t* value) {
+	if (r->size - r->pos < sizeof(uint32_t)) return false;
+	memcpy(value, r->data + r->pos, sizeof(uint32_t));
+	r->pos += sizeof(uint32_t);
+	return true;
+}
+
+
+// Seules les entités déjà créées, hors zone transitoire, peuvent être modifiées (avant tout cast en ArlEntity)
+static inline bool delta_entity(const ArlEcsWorld* world, uint32_t e) {
+	return e < world->max_entities && e < world->entity_counter && e < world->transient_base;
+}
+
+
+bool arlecs_world_apply_delta(ArlEcsWorld* world, const void* data, size_t size) {
+	DeltaReader r = { (const uint8_t*)data, size, 0 };
+	uint32_t magic, entity_counter, pool_count;
+
+	if (! read_u32(&r, &magic) || magic != ARLECS_DELTA_MAGIC) return false;
+	if (! read_u32(&r, &entity_counter) || entity_counter > world->transient_base) return false;
+	if (! read_u32(&r, &pool_count)) return false;
+
+	if (entity_counter > world->entity_counter) world->entity_counter = entity_counter;
+
+	for (uint32_t p = 0; p < pool_count; p++) {
+		uint32_t id, elem_size, removed, upserts;
+		if (! read_u32(&r, &id) || ! read_u32(&r, &elem_size)) return false;
+		if (! read_u32(&r, &removed) || ! read_u32(&r, &upserts)) return false;
+
+		if (id >= world->component_counter || ! world->pools[id]) return false;
+		ArlPool* pool = world->pools[id];
+		if (pool->elem_size != elem_size) return false;
+
+		for (uint32_t i = 0; i < removed; i++) {
+			uint32_t e;
+			if (! read_u32(&r, &e) || ! delta_entity(world, e)) return false;
+			arlecs_pool_remove(pool, (ArlEntity)e);
+		}
+
+		for (uint32_t i = 0; i < upserts; i++) {
+			uint32_t e;
+			if (! read_u32(&r, &e) || ! delta_entity(world, e) || r.size - r.pos < elem_size) return false;
+
+			void* dst = arlecs_pool_add(pool, (ArlEntity)e);
+			if (! dst) return false;
+
+			memcpy(dst, r.data + r.pos, elem_size);
+			r.pos += elem_size;
+		}
+
+		// Composants existants réécrits sur place : les systèmes réactifs doivent le voir
+		if (upserts) arlecs_pool_touch(pool);
+	}
+
+	return r.pos == r.size;
+}
@@ -0,0 +1,314 @@
+#include <ArmelECS/arlecs_loader.h>
+#include <ArmelECS/arlecs_system.h> // arlecs_sys_now_ns
+
+
+// En-tête d'un chunk : n, k, puis k paires (id, taille)
+typedef struct {
+	uint32_t n, k;
+	const uint32_t* pairs;
+	const uint8_t* columns[ARLECS_LOADER_MAX_COMPONENTS];
+} LoaderChunk;
+
+
+// --- Lecture (thread de fond, ou appelant sans threads) ---
+
+// Lit un chunk complet dans un buffer. *eof passe à true en fin de flux propre.
+static bool read_chunk(ArlStreamLoader* loader, uint32_t b, bool* eof) {
+	uint8_t* buf = loader->buffers[b];
+	uint32_t head[2];
+
+	*eof = false;
+	size_t got = fread(head, 1, sizeof(head), loader->file);
+	if (got == 0 && feof(loader->file)) {
+		*eof = true;
+		return true;
+	}
+	if (got != sizeof(head) || head[1] > ARLECS_LOADER_MAX_COMPONENTS) return false;
+
+	size_t pairs_bytes = (size_t)head[1] * 2 * sizeof(uint32_t);
+	if (sizeof(head) + pairs_bytes > loader->buffer_size) return false;
+
+	memcpy(buf, head, sizeof(head));
+	if (fread(buf + sizeof(head), 1, pairs_bytes, loader->file) != pairs_bytes) return false;
+
+	// Taille des colonnes, bornée par le buffer
+	const uint32_t* pairs = (const uint32_t*)(buf + sizeof(head));
+	size_t columns_bytes = 0;
+	for (uint32_t j = 0; j < head[1]; j++) {
+		columns_bytes += (size_t)head[0] * pairs[2 * j + 1];
+		if (columns_bytes > loader->buffer_size) return false;
+	}
+	if (sizeof(head) + pairs_bytes + columns_bytes > loader->buffer_size) return false;
+
+	return fread(buf + sizeof(head) + pairs_bytes, 1, columns_bytes, loader->file) == columns_bytes;
+}
+
+#ifndef _WIN32
+static void* reader_main(void* arg) {
+	ArlStreamLoader* loader = (ArlStreamLoader*)arg;
+	uint32_t next = 0;
+
+	for (;;) {
+		pthread_mutex_lock(&loader->lock);
+		while (loader->ready[next] && ! loader->stop) pthread_cond_wait(&loader->changed, &loader->lock);
+		bool stop = loader->stop;
+		pthread_mutex_unlock(&loader->lock);
+		if (stop) break;
+
+		// Le buffer libre n'est pas lu par l'inserteur : remplissage hors verrou
+		bool eof;
+		bool ok = read_chunk(loader, next, &eof);
+
+		pthread_mutex_lock(&loader->lock);
+		if (! ok || eof) {
+			loader->reader_done = true;
+			loader->read_error = ! ok;
+		} else {
+			loader->ready[next] = true;
+		}
+		pthread_cond_broadcast(&loader->changed);
+		pthread_mutex_unlock(&loader->lock);
+
+		if (! ok || eof) break;
+		next ^= 1;
+	}
+	return NULL;
+}
+#endif
+
+// Le buffer courant est-il prêt ? (sans attendre, sauf en mode synchrone)
+static bool current_ready(ArlStreamLoader* loader, bool* finished) {
+	bool ready;
+#ifndef _WIN32
+	if (loader->threaded) {
+		pthread_mutex_lock(&loader->lock);
+		ready = loader->ready[loader->current];
+		*finished = ! ready && loader->reader_done;
+		pthread_mutex_unlock(&loader->lock);
+		return ready;
+	}
+#endif
+	// Sans thread : lecture directe
+	if (! loader->ready[loader->current] && ! loader->reader_done) {
+		bool eof;
+		bool ok = read_chunk(loader, loader->current, &eof);
+		if (! ok || eof) {
+			loader->reader_done = true;
+			loader->read_error = ! ok;
+		} else {
+			loader->ready[loader->current] = true;
+		}
+	}
+	ready = loader->ready[loader->current];
+	*finished = ! ready && loader->reader_done;
+	return ready;
+}
+
+static void release_current(ArlStreamLoader* loader) {
+#ifndef _WIN32
+	if (loader->threaded) {
+		pthread_mutex_lock(&loader->lock);
+		loader->ready[loader->current] = false;
+		pthread_cond_broadcast(&loader->changed);
+		pthread_mutex_unlock(&loader->lock);
+		loader->current ^= 1;
+		return;
+	}
+#endif
+	loader->ready[loader->current] = false;
+	loader->current ^= 1;
+}
+
+
+// --- Insertion ---
+
+static bool parse_chunk(ArlStreamLoader* loader, LoaderChunk* chunk) {
+	const uint8_t* buf = loader->buffers[loader->current];
+	memcpy(&chunk->n, buf, sizeof(uint32_t));
+	memcpy(&chunk->k, buf + sizeof(uint32_t), sizeof(uint32_t));
+	chunk->pairs = (const uint32_t*)(buf + 2 * sizeof(uint32_t));
+
+	const uint8_t* column = buf + 2 * sizeof(uint32_t) + (size_t)chunk->k * 2 * sizeof(uint32_t);
+	ArlEcsWorld* world = loader->world;
+
+	// Tout l'en-tête est validé avant la moindre écriture : le monde n'est jamais à moitié modifié
+	uint32_t remaining = chunk->n - loader->chunk_done;
+	if (remaining > world->transient_base - world->entity_counter) return false;
+
+	ArlComponentMask seen;
+	arlecs_mask_clear(&seen);
+
+	for (uint32_t j = 0; j < chunk->k; j++) {
+		uint32_t id = chunk->pairs[2 * j], size = chunk->pairs[2 * j + 1];
+		if (id >= world->component_counter || ! world->pools[id] || world->pools[id]->type_size != size) return false;
+		if (arlecs_mask_test(&seen, id)) return false; // Deux colonnes pour le même composant
+		arlecs_mask_set(&seen, id);
+
+		// Place pour tout le reste du chunk, réservée en fin de pool (pas de transitoires derrière)
+		// Les pools hachés n'acceptent pas les réservations de slots
+		const ArlPool* pool = world->pools[id];
+		if (pool->hash || pool->transient_count || remaining > pool->dense_capacity - pool->count) return false;
+
+		chunk->columns[j] = column;
+		column += (size_t)chunk->n * size;
+	}
+	return true;
+}
+
+// Insère les entités [from, from + m) du chunk : une réservation et un memcpy par colonne
+static bool insert_batch(ArlStreamLoader* loader, const LoaderChunk* chunk, uint32_t from, uint32_t m) {
+	ArlEcsWorld* world = loader->world;
+
+	// Vérifié avant de réserver quoi que ce soit (le chunk l'a déjà été en entier)
+	if (m > world->transient_base - world->entity_counter) return false;
+	for (uint32_t j = 0; j < chunk->k; j++) {
+		const ArlPool* pool = world->pools[chunk->pairs[2 * j]];
+		if (m > pool->dense_capacity - pool->count) return false;
+	}
+
+	ArlEntity first = arlecs_reserve_entities(world, m);
+
+	for (uint32_t j = 0; j < chunk->k; j++) {
+		ArlPool* pool = world->pools[chunk->pairs[2 * j]];
+		uint32_t slot = arlecs_pool_reserve_slots(pool, m);
+		if (slot == ARL_NULL_ID) return false;
+
+		// Colonne contiguë dans le flux : un memcpy, sauf si le pool a un stride aligné
+		const uint8_t* src = chunk->columns[j] + (size_t)from * pool->type_size;
+		uint8_t* dst = pool->data + (size_t)slot * pool->elem_size;
+		if (pool->elem_size == pool->type_size) {
+			memcpy(dst, src, (size_t)m * pool->elem_size);
+		} else {
+			for (uint32_t i = 0; i < m; i++) memcpy(dst + (size_t)i * pool->elem_size, src + (size_t)i * pool->type_size, pool->type_size);
+		}
+
+		for (uint32_t i = 0; i < m; i++) arlecs_pool_emplace(pool, slot + i, (ArlEntity)(first + i));
+		arlecs_pool_touch(pool); // Data copiée hors de pool_add : version explicite
+	}
+	return true;
+}
+
+
+ArlLoadStatus arlecs_loader_step(ArlStreamLoader* loader, uint32_t max_entities, uint32_t max_us) {
+	if (loader->status != ARL_LOAD_PENDING) return loader->status;
+
+	uint64_t deadline = max_us ? arlecs_sys_now_ns() + (uint64_t)max_us * 1000 : 0;
+	uint32_t inserted = 0;
+
+	for (;;) {
+		bool finished;
+		if (! current_ready(loader, &finished)) {
+			if (finished) {
+				bool complete = ! loader->read_error && loader->loaded == loader->total;
+				loader->status = complete ? ARL_LOAD_DONE : ARL_LOAD_ERROR;
+			}
+			return loader->status; // Chunk suivant pas encore lu : on rend la main
+		}
+
+		LoaderChunk chunk;
+		if (! parse_chunk(loader, &chunk)) return loader->status = ARL_LOAD_ERROR;
+
+		while (loader->chunk_done < chunk.n) {
+			uint32_t m = chunk.n - loader->chunk_done;
+			if (m > ARLECS_LOADER_BATCH) m = ARLECS_LOADER_BATCH;
+			if (max_entities) {
+				if (inserted >= max_entities) return loader->status;
+				if (m > max_entities - inserted) m = max_entities - inserted;
+			}
+
+			if (! insert_batch(loader, &chunk, loader->chunk_done, m)) return loader->status = ARL_LOAD_ERROR;
+
+			loader->chunk_done += m;
+			loader->loaded += m;
+			inserted += m;
+
+			if (deadline && arlecs_sys_now_ns() >= deadline && loader->chunk_done < chunk.n) return loader->status;
+		}
+
+		// Chunk terminé : le buffer repart au lecteur
+		loader->chunk_done = 0;
+		release_current(loader);
+
+		if (deadline && arlecs_sys_now_ns() >= deadline) return loader->status;
+	}
+}
+
+
+// --- Cycle de vie ---
+
+bool arlecs_loader_open(ArlStreamLoader* loader, ArlEcsWorld* world, FILE* file, size_t buffer_size, Armel* arena) {
+	memset(loader, 0, sizeof(*loader));
+	loader->world = world;
+	loader->file = file;
+	loader->status = ARL_LOAD_PENDING;
+
+	uint32_t head[3];
+	if (fread(head, 1, sizeof(head), file) != sizeof(head)) return false;
+	if (head[0] != ARLECS_LOADER_MAGIC || head[1] != ARLECS_LOADER_VERSION) return false;
+	loader->total = head[2];
+
+	loader->buffer_size = buffer_size;
+	loader->buffers[0] = (uint8_t*)arl_alloc(arena, buffer_size);
+	loader->buffers[1] = (uint8_t*)arl_alloc(arena, buffer_size);
+	if (! loader->buffers[0] || ! loader->buffers[1]) return false;
+
+#ifndef _WIN32
+	pthread_mutex_init(&loader->lock, NULL);
+	pthread_cond_init(&loader->changed, NULL);
+	loader->synced = true;
+	loader->threaded = pthread_create(&loader->thread, NULL, reader_main, loader) == 0;
+#endif
+
+	return true;
+}
+
+
+void arlecs_loader_close(ArlStreamLoader* loader) {
+#ifndef _WIN32
+	if (loader->threaded) {
+		pthread_mutex_lock(&loader->lock);
+		loader->stop = true;
+		pthread_cond_broadcast(&loader->changed);
+		pthread_mutex_unlock(&loader->lock);
+
+		pthread_join(loader->thread, NULL);
+		loader->threaded = false;
+	}
+
+	// open() a pu échouer avant de les créer
+	if (loader->synced) {
+		pthread_mutex_destroy(&loader->lock);
+		pthread_cond_destroy(&loader->changed);
+		loader->synced = false;
+	}
+#endif
+	loader->stop = true;
+}
+
+
+// --- Écriture ---
+
+bool arlecs_loader_write_header(FILE* file, uint32_t total) {
+	uint32_t head[3] = { ARLECS_LOADER_MAGIC, ARLECS_LOADER_VERSION, total };
+	return fwrite(head, sizeof(head), 1, file) == 1;
+}
+
+
+bool arlecs_loader_write_chunk(FILE* file, uint32_t n, uint32_t k,
+                               const uint32_t* ids, const uint32_t* sizes, const void* const* columns) {
+	if (k > ARLECS_LOADER_MAX_COMPONENTS) return false;
+
+	uint32_t head[2] = { n, k };
+	if (fwrite(head, sizeof(head), 1, file) != 1) return false;
+
+	for (uint32_t j = 0; j < k; j++) {
+		uint32_t pair[2] = { ids[j], sizes[j] };
+		if (fwrite(pair, sizeof(pair), 1, file) != 1) return false;
+	}
+
+	for (uint32_t j = 0; j < k; j++) {
+		size_t bytes = (size_t)n * sizes[j];
+		if (bytes && fwrite(columns[j], 1, bytes, file) != bytes) return false;
+	}
+	return true;
+}
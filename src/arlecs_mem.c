@@ -0,0 +1,65 @@
+#include <ArmelECS/arlecs_mem.h>
+
+#if defined(__linux__)
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+
+	// Évite la dépendance à libnuma (numaif.h)
+	#define ARL_MPOL_BIND     2
+	#define ARL_MPOL_MF_MOVE  (1 << 1)
+#endif
+
+
+uint32_t arlecs_mem_advise(void* ptr, size_t size, uint32_t flags, int numa_node) {
+	uint32_t done = ARLECS_MEM_DEFAULT;
+
+#if defined(__linux__)
+	// Seules les pages entièrement comprises dans la zone sont concernées
+	const uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+	uintptr_t start = ((uintptr_t)ptr + page - 1) & ~(page - 1);
+	uintptr_t stop  = ((uintptr_t)ptr + size) & ~(page - 1);
+	if (stop <= start) return done;
+
+	#ifdef MADV_HUGEPAGE
+	if ((flags & ARLECS_MEM_HUGEPAGES) && madvise((void*)start, stop - start, MADV_HUGEPAGE) == 0) {
+		done |= ARLECS_MEM_HUGEPAGES;
+	}
+	#endif
+
+	#ifdef SYS_mbind
+	if ((flags & ARLECS_MEM_NUMA) && numa_node >= 0 && numa_node < 64) {
+		unsigned long nodemask = 1UL << numa_node;
+		if (syscall(SYS_mbind, start, stop - start, ARL_MPOL_BIND, &nodemask, 64, ARL_MPOL_MF_MOVE) == 0) {
+			done |= ARLECS_MEM_NUMA;
+		}
+	}
+	#endif
+#else
+	(void)ptr; (void)size; (void)flags; (void)numa_node;
+#endif
+
+	return done;
+}
+
+
+uint32_t arlecs_arena_new_huge(Armel* armel, size_t size, uint32_t flags, int numa_node) {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+	size_t padded = arl_align_up(size, ARLECS_HUGE_PAGE_SIZE);
+	ARL_ASSERT_FATAL(padded <= ARL_MAX_MEMORY, "arlecs_arena_new_huge: Size exceeds ARL_MAX_MEMORY");
+
+	void* ptr = mmap(NULL, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+	if (ptr != MAP_FAILED) {
+		arl_new_local(armel, ptr, padded, ARL_ALIGN, ARL_NOFLAG);
+		armel->capacity = padded; // arl_free() rend la zone au système
+
+		uint32_t done = ARLECS_MEM_HUGETLB | ARLECS_MEM_HUGEPAGES;
+		return done | arlecs_mem_advise(ptr, padded, flags & ARLECS_MEM_NUMA, numa_node);
+	}
+#endif
+
+	// Pas de huge pages réservées : arène classique + indication THP
+	arl_new(armel, size);
+	return arlecs_mem_advise(armel->base, armel->capacity, flags | ARLECS_MEM_HUGEPAGES, numa_node);
+}
@@ -0,0 +1,174 @@
+#include <ArmelECS/arlecs_persist.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define ARLECS_HAS_PERSIST 1
+#endif
+
+
+#ifdef ARLECS_HAS_PERSIST
+
+// Le fichier vient-il de ce build ?
+static bool header_valid(const ArlPersistHeader* h, size_t file_size) {
+	return h->magic == ARLECS_PERSIST_MAGIC
+		&& h->version == ARLECS_PERSIST_VERSION
+		&& h->world_size == sizeof(ArlEcsWorld)
+		&& h->max_components == ARLECS_MAX_COMPONENT_TYPES
+		&& h->size == file_size
+		&& h->cursor >= ARLECS_PERSIST_HEADER_SIZE && h->cursor <= h->size
+		&& h->world < h->size;
+}
+
+
+bool arlecs_persist_open(ArlPersistentArena* pa, const char* path, size_t size) {
+	memset(pa, 0, sizeof(*pa));
+	pa->fd = -1;
+
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) return false;
+
+	// 1. Fichier existant : on relit l'en-tête pour connaître taille et adresse
+	ArlPersistHeader saved;
+	bool existing = false;
+	struct stat st;
+
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return false;
+	}
+
+	if (st.st_size > 0) {
+		existing = (size_t)st.st_size >= ARLECS_PERSIST_HEADER_SIZE
+			&& pread(fd, &saved, sizeof(saved), 0) == (ssize_t)sizeof(saved)
+			&& header_valid(&saved, (size_t)st.st_size);
+
+		// Fichier non vide qui n'est pas un monde de ce build : jamais écrasé
+		if (! existing) {
+			close(fd);
+			return false;
+		}
+	}
+
+	if (existing) {
+		size = (size_t)saved.size;
+	} else {
+		size = arl_align_up(size < 2 * ARLECS_PERSIST_HEADER_SIZE ? 2 * ARLECS_PERSIST_HEADER_SIZE : size, ARLECS_PERSIST_HEADER_SIZE);
+		if (ftruncate(fd, (off_t)size) != 0) {
+			close(fd);
+			return false;
+		}
+	}
+
+	// 2. Mapping, à l'ancienne adresse si possible (simple indication, pas de MAP_FIXED)
+	void* hint = existing ? (void*)(uintptr_t)saved.base : NULL;
+	void* map = mmap(hint, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		close(fd);
+		return false;
+	}
+
+	ArlPersistHeader* h = (ArlPersistHeader*)map;
+	uint8_t* bytes = (uint8_t*)map;
+
+	if (! existing) {
+		memset(h, 0, sizeof(*h));
+		h->magic          = ARLECS_PERSIST_MAGIC;
+		h->version        = ARLECS_PERSIST_VERSION;
+		h->world_size     = sizeof(ArlEcsWorld);
+		h->max_components = ARLECS_MAX_COMPONENT_TYPES;
+		h->size           = size;
+		h->base           = (uint64_t)(uintptr_t)map;
+		h->cursor         = ARLECS_PERSIST_HEADER_SIZE;
+		h->world          = 0;
+	}
+
+	pa->header = h;
+	pa->size   = size;
+	pa->fd     = fd;
+
+	// 3. Arène locale sur la zone après l'en-tête, curseur restauré
+	arl_new_local(&pa->arena, bytes + ARLECS_PERSIST_HEADER_SIZE, size - ARLECS_PERSIST_HEADER_SIZE, ARL_ALIGN, ARL_NOFLAG);
+	pa->arena.cursor = bytes + h->cursor;
+
+	// 4. Monde existant : recalage des pointeurs si l'adresse a changé
+	if (h->world) {
+		ArlEcsWorld* world = (ArlEcsWorld*)(bytes + h->world);
+		uintptr_t old_base = (uintptr_t)h->base;
+
+		if (old_base != (uintptr_t)map) {
+			arlecs_world_relocate(world, old_base, old_base + size, (intptr_t)((uintptr_t)map - old_base));
+			pa->relocated = true;
+		}
+
+		// Pointeurs vers la mémoire de l'ancien processus
+		world->arena          = &pa->arena;
+		world->frame_scratch  = NULL;
+		world->worker_scratch = NULL;
+		world->worker_count   = 0;
+		world->slice          = NULL;
+		world->footprint      = 0;
+
+		pa->world = world;
+	}
+
+	h->base = (uint64_t)(uintptr_t)map;
+	return true;
+}
+
+
+ArlEcsWorld* arlecs_persist_world(ArlPersistentArena* pa, uint32_t max_entities) {
+	if (pa->world) return pa->world;
+
+	ArlEcsWorld* world = arlecs_world_create(&pa->arena, max_entities);
+	pa->header->world = (uint64_t)((uintptr_t)world - (uintptr_t)pa->header);
+	pa->world = world;
+
+	arlecs_persist_checkpoint(pa, false);
+	return world;
+}
+
+
+bool arlecs_persist_checkpoint(ArlPersistentArena* pa, bool blocking) {
+	pa->header->cursor = (uint64_t)((uintptr_t)pa->arena.cursor - (uintptr_t)pa->header);
+	return msync(pa->header, pa->size, blocking ? MS_SYNC : MS_ASYNC) == 0;
+}
+
+
+void arlecs_persist_close(ArlPersistentArena* pa) {
+	if (! pa->header) return;
+
+	arlecs_persist_checkpoint(pa, true);
+	munmap(pa->header, pa->size);
+	close(pa->fd);
+
+	memset(pa, 0, sizeof(*pa));
+	pa->fd = -1;
+}
+
+#else
+
+bool arlecs_persist_open(ArlPersistentArena* pa, const char* path, size_t size) {
+	(void)path; (void)size;
+	memset(pa, 0, sizeof(*pa));
+	pa->fd = -1;
+	return false;
+}
+
+ArlEcsWorld* arlecs_persist_world(ArlPersistentArena* pa, uint32_t max_entities) {
+	(void)max_entities;
+	return pa->world;
+}
+
+bool arlecs_persist_checkpoint(ArlPersistentArena* pa, bool blocking) {
+	(void)pa; (void)blocking;
+	return false;
+}
+
+void arlecs_persist_close(ArlPersistentArena* pa) {
+	(void)pa;
+}
+
+#endif
@@ -1,69 +1,538 @@
 #include <ArmelECS/arlecs_pool.h>
+#include <ArmelECS/arlecs_mem.h>
+#include <ArmelECS/arlecs_atomic.h>
+
+// Bloc aligné sur 'align' : on ne paie le surplus que si l'arène est moins alignée
+static void* alloc_aligned(Armel* arena, size_t size, size_t align) {
+	if (arena->alignment >= align) return arl_alloc(arena, size);
+
+	uint8_t* raw = (uint8_t*)arl_alloc(arena, size + align - 1);
+	return (void*)arl_align_up((uintptr_t)raw, align);
+}
 
 ArlPool* arlecs_pool_new(Armel* arena, size_t elem_size, uint32_t max_entities) {
+	ArlPoolDesc desc = { elem_size, ARLECS_POOL_DEFAULT, 0.0f, 0, 0 };
+	return arlecs_pool_new_desc(arena, &desc, max_entities);
+}
+
+ArlPool* arlecs_pool_new_desc(Armel* arena, const ArlPoolDesc* desc, uint32_t max_entities) {
+	return arlecs_pool_new_ex(arena, desc, max_entities, ARLECS_MEM_DEFAULT, -1);
+}
+
+ArlPool* arlecs_pool_new_ex(Armel* arena, const ArlPoolDesc* desc, uint32_t max_entities, uint32_t mem_flags, int numa_node) {
+	assert((desc->align & (desc->align - 1)) == 0 && "ArlECS Error: Component alignment must be a power of two");
+	assert((desc->flags & (ARLECS_POOL_INDEX16 | ARLECS_POOL_HASHED)) != (ARLECS_POOL_INDEX16 | ARLECS_POOL_HASHED)
+		&& "ArlECS Error: INDEX16 and HASHED pools are exclusive");
+
+	// Alignement de la data : au moins une ligne de cache, stride arrondi en mode PADDED
+	size_t align     = desc->align > ARLECS_POOL_DATA_ALIGN ? desc->align : ARLECS_POOL_DATA_ALIGN;
+	size_t elem_size = desc->elem_size;
+	if ((desc->flags & ARLECS_POOL_PADDED) && desc->align) elem_size = arl_align_up(elem_size, desc->align);
+
+	// Le maillon de la liste libre est stocké dans la data du slot mort
+	assert((! (desc->flags & ARLECS_POOL_STABLE) || elem_size >= sizeof(uint32_t))
+		&& "ArlECS Error: Stable pools need components of at least 4 bytes");
+
 	// 1. Alloue la structure de gestion
 	ArlPool* pool = arl_make(arena, ArlPool);
 	
 	pool->elem_size = elem_size;
+	pool->type_size = desc->elem_size;
+	pool->align     = align;
 	pool->capacity  = max_entities;
 	pool->count     = 0;
 
+	// Index 16 bits : la largeur ne change que la taille des entrées du sparse
+	bool narrow = (desc->flags & ARLECS_POOL_INDEX16) != 0;
+	bool hashed = (desc->flags & ARLECS_POOL_HASHED) != 0;
+	pool->sparse_shift   = narrow ? 1 : 2;
+	pool->sparse_mask    = narrow ? 0xFFFF : 0xFFFFFFFF;
+	pool->sparse_limit   = hashed ? 0 : max_entities;
+
+	// Nombre max de composants : max_entities par défaut, borné par la largeur d'index
+	uint32_t slots = desc->max_count ? desc->max_count : (hashed ? ARLECS_POOL_HASH_CAPACITY : max_entities);
+	if (slots > max_entities) slots = max_entities;
+	if (narrow && slots > ARLECS_INDEX16_MAX) slots = ARLECS_INDEX16_MAX;
+	pool->dense_capacity = slots;
+
+	pool->adds      = 0;
+	pool->removes   = 0;
+	pool->swaps     = 0;
+	pool->touches   = 0;
+
+	pool->mem_flags = ARLECS_MEM_DEFAULT;
+
+	pool->flags          = desc->flags;
+	pool->tombstones     = 0;
+	pool->free_head      = ARL_NULL_ID;
+	pool->compact_ratio  = desc->compact_ratio > 0.0f ? desc->compact_ratio : ARLECS_POOL_COMPACT_RATIO;
+	pool->tombstone_bits = NULL;
+	pool->transient_count = 0;
+	pool->bits           = NULL;
+	pool->bits_top       = NULL;
+	pool->hash           = NULL;
+	pool->hash_mask      = 0;
+	pool->hash_shift     = 0;
+
 	// 2. Alloue les tableaux (Sparse, Dense, Data)
-	// Le Sparse doit être initialisé à "VIDE" (0xFF...)
-	pool->sparse = arl_array(arena, uint32_t, max_entities);
-	memset(pool->sparse, 0xFF, max_entities * sizeof(uint32_t)); 
+	if (hashed) {
+		// Table de hachage à la place du sparse : au moins deux cases par composant (charge <= 50%)
+		uint32_t size = 16, bits = 4;
+		while (size < 2 * (size_t)slots) {
+			size <<= 1;
+			bits++;
+		}
+		pool->sparse     = NULL;
+		pool->hash_mask  = size - 1;
+		pool->hash_shift = 32 - bits;
+		pool->hash       = arl_array(arena, ArlHashSlot, size);
+	} else {
+		// + 4 octets : arlecs_sparse_load() lit toujours 4 octets, même pour la dernière entrée 16 bits
+		pool->sparse = (uint8_t*)arl_alloc(arena, ((size_t)max_entities << pool->sparse_shift) + sizeof(uint32_t));
+	}
 
-	pool->dense = arl_array(arena, ArlEntity, max_entities);
+	pool->dense = arl_array(arena, ArlEntity, slots);
 	
-	// Data brute : on alloue capacity * taille_du_composant
-	pool->data  = (uint8_t*)arl_alloc(arena, max_entities * elem_size);
+	// Data brute : on alloue capacity * stride, alignée pour les chargements SIMD
+	pool->data  = (uint8_t*)alloc_aligned(arena, (size_t)slots * elem_size, align);
+
+	// 3. Indications mémoire avant le premier accès : une page déjà touchée reste en 4 Ko sur son nœud
+	if (mem_flags) arlecs_pool_advise(pool, mem_flags, numa_node);
+
+	// Le Sparse doit être initialisé à "VIDE" (0xFF...)
+	if (hashed) memset(pool->hash, 0xFF, ((size_t)pool->hash_mask + 1) * sizeof(ArlHashSlot));
+	else memset(pool->sparse, 0xFF, ((size_t)max_entities << pool->sparse_shift) + sizeof(uint32_t));
+
+	// Bitmap des tombes : un bit par slot, uniquement en mode stable
+	if (desc->flags & ARLECS_POOL_STABLE) {
+		pool->tombstone_bits = (uint64_t*)arl_alloc_zeroed(arena, ARLECS_BITSET_WORDS(slots) * sizeof(uint64_t));
+	}
+
+	if (desc->flags & ARLECS_POOL_BITSET) arlecs_pool_enable_bitset(pool, arena);
 
 	return pool;
 }
 
+void arlecs_pool_enable_bitset(ArlPool* pool, Armel* arena) {
+	if (pool->bits) return;
+
+	pool->bits     = (uint64_t*)arl_alloc_zeroed(arena, ARLECS_BITSET_WORDS(pool->capacity) * sizeof(uint64_t));
+	pool->bits_top = (uint64_t*)arl_alloc_zeroed(arena, ARLECS_BITSET_TOP_WORDS(pool->capacity) * sizeof(uint64_t));
+	pool->flags |= ARLECS_POOL_BITSET;
+
+	for (uint32_t i = 0; i < pool->count; i++) {
+		if (pool->dense[i] != ARL_NULL_ENTITY) arlecs_pool_bit_set(pool, pool->dense[i]);
+	}
+}
+
+uint32_t arlecs_pool_advise(ArlPool* pool, uint32_t flags, int numa_node) {
+	// Chaque tableau séparément : ils peuvent vivre dans des arènes chaînées
+	uint32_t done = flags;
+	if (pool->hash) done &= arlecs_mem_advise(pool->hash, ((size_t)pool->hash_mask + 1) * sizeof(ArlHashSlot), flags, numa_node);
+	else done &= arlecs_mem_advise(pool->sparse, (size_t)pool->capacity << pool->sparse_shift, flags, numa_node);
+	done &= arlecs_mem_advise(pool->dense, (size_t)pool->dense_capacity * sizeof(ArlEntity), flags, numa_node);
+	done &= arlecs_mem_advise(pool->data, (size_t)pool->dense_capacity * pool->elem_size, flags, numa_node);
+
+	pool->mem_flags = done;
+	return done;
+}
+
+
+void arlecs_hash_store(ArlPool* pool, ArlEntity entity, uint32_t index) {
+	uint32_t mask = pool->hash_mask;
+	uint32_t slot = arlecs_hash_home(pool, entity);
+
+	// Sondage linéaire jusqu'à l'entité ou une case vide (la charge reste <= 50%)
+	while (pool->hash[slot].entity != (uint32_t)entity && pool->hash[slot].entity != ARL_NULL_ID) slot = (slot + 1) & mask;
+
+	if (index != ARL_NULL_ID) {
+		pool->hash[slot].entity = entity;
+		pool->hash[slot].index  = index;
+		return;
+	}
+	if (pool->hash[slot].entity == ARL_NULL_ID) return; // Absente
+
+	// Effacement par décalage arrière : pas de marqueur, les sondages restent courts
+	uint32_t hole = slot;
+	for (uint32_t next = (hole + 1) & mask; pool->hash[next].entity != ARL_NULL_ID; next = (next + 1) & mask) {
+		uint32_t home = arlecs_hash_home(pool, pool->hash[next].entity);
+		if (((next - home) & mask) >= ((next - hole) & mask)) {
+			pool->hash[hole] = pool->hash[next];
+			hole = next;
+		}
+	}
+	pool->hash[hole].entity = ARL_NULL_ID;
+	pool->hash[hole].index  = ARL_NULL_ID;
+}
+
+
+// Entrée entité -> index : sparse, ou table de hachage pour les pools hachés
+static inline void index_store(ArlPool* pool, ArlEntity entity, uint32_t index) {
+	if (pool->hash) arlecs_hash_store(pool, entity, index);
+	else arlecs_sparse_store(pool, entity, index);
+}
+
+
+// Déplace un élément d'un slot à un autre (liens dense / sparse compris)
+static void move_slot(ArlPool* pool, uint32_t from, uint32_t to) {
+	ArlEntity e = pool->dense[from];
+	memcpy(pool->data + ((size_t)to * pool->elem_size), pool->data + ((size_t)from * pool->elem_size), pool->elem_size);
+	pool->dense[to] = e;
+	index_store(pool, e, to);
+	pool->swaps++;
+}
+
+
 void* arlecs_pool_add(ArlPool* pool, ArlEntity entity) {
 	if (entity >= pool->capacity) return NULL;
 
-	// Si déjà présent, on renvoie l'existant
-	if (pool->sparse[entity] != ARL_NULL_ID) {
-		return pool->data + (pool->sparse[entity] * pool->elem_size);
+	// Si déjà présent, on renvoie l'existant (entrée vérifiée : celles des transitoires expirés sont périmées)
+	uint32_t existing = arlecs_pool_index(pool, entity);
+	if (existing != ARL_NULL_ID) {
+		return pool->data + ((size_t)existing * pool->elem_size);
+	}
+
+	// Mode stable : on réutilise d'abord un slot mort
+	if (pool->free_head != ARL_NULL_ID) {
+		uint32_t index = pool->free_head;
+		uint8_t* slot = pool->data + ((size_t)index * pool->elem_size);
+		memcpy(&pool->free_head, slot, sizeof(uint32_t));
+
+		pool->tombstone_bits[index >> 6] &= ~((uint64_t)1 << (index & 63));
+		pool->tombstones--;
+
+		index_store(pool, entity, index);
+		pool->dense[index]   = entity;
+		pool->adds++;
+		if (pool->bits) arlecs_pool_bit_set(pool, entity);
+
+		return slot;
 	}
 
 	// Sinon, on ajoute à la fin du tableau dense
 	uint32_t index = pool->count;
+	assert(index < pool->dense_capacity && "ArlECS Error: Pool full");
+	if (index >= pool->dense_capacity) return NULL;
+
+	// Zone transitoire en fin de tableau : son premier élément passe au bout, on prend sa place
+	if (pool->transient_count) {
+		uint32_t first_transient = index - pool->transient_count;
+		move_slot(pool, first_transient, index);
+		index = first_transient;
+	}
 	
-	pool->sparse[entity] = index; 
+	index_store(pool, entity, index); 
 	pool->dense[index]   = entity;
 	
 	pool->count++;
+	pool->adds++;
+	if (pool->bits) arlecs_pool_bit_set(pool, entity);
 
 	return pool->data + (index * pool->elem_size);
 }
 
 
+void* arlecs_pool_add_run(ArlPool* pool, ArlEntity first, uint32_t n) {
+	assert((size_t)first + n <= pool->capacity && "ArlECS Error: Entity out of pool capacity");
+	if (n > pool->dense_capacity - pool->count) return NULL;
+
+	// Zone transitoire : ses k premiers éléments passent au bout pour libérer n slots contigus
+	uint32_t start = pool->count - pool->transient_count;
+	uint32_t k = n < pool->transient_count ? n : pool->transient_count;
+	if (k) {
+		uint32_t to = pool->count + n - k;
+		memcpy(pool->data + (size_t)to * pool->elem_size, pool->data + (size_t)start * pool->elem_size, (size_t)k * pool->elem_size);
+		memcpy(pool->dense + to, pool->dense + start, (size_t)k * sizeof(ArlEntity));
+		for (uint32_t i = to; i < to + k; i++) index_store(pool, pool->dense[i], i);
+		pool->swaps += k;
+	}
+
+	// Une seule passe sur dense et sparse
+	for (uint32_t i = 0; i < n; i++) {
+		ArlEntity e = (ArlEntity)(first + i);
+		pool->dense[start + i] = e;
+		index_store(pool, e, start + i);
+		if (pool->bits) arlecs_pool_bit_set(pool, e);
+	}
+
+	pool->count += n;
+	pool->adds  += n;
+
+	return pool->data + ((size_t)start * pool->elem_size);
+}
+
+
+void* arlecs_pool_add_transient(ArlPool* pool, ArlEntity entity) {
+	if (entity >= pool->capacity) return NULL;
+
+	uint32_t existing = arlecs_pool_index(pool, entity);
+	if (existing != ARL_NULL_ID) {
+		return pool->data + ((size_t)existing * pool->elem_size);
+	}
+
+	// Toujours en fin de tableau, jamais dans un slot mort
+	uint32_t index = pool->count;
+	assert(index < pool->dense_capacity && "ArlECS Error: Pool full");
+	if (index >= pool->dense_capacity) return NULL;
+
+	index_store(pool, entity, index);
+	pool->dense[index] = entity;
+
+	pool->count++;
+	pool->transient_count++;
+	pool->adds++;
+	if (pool->bits) arlecs_pool_bit_set(pool, entity);
+
+	return pool->data + ((size_t)index * pool->elem_size);
+}
+
+
+void arlecs_pool_expire_transients(ArlPool* pool, ArlEntity first, uint32_t n) {
+	// Table de hachage : les entrées mortes occuperaient des cases, on les efface
+	if (pool->hash) {
+		for (uint32_t i = pool->count - pool->transient_count; i < pool->count; i++) arlecs_hash_store(pool, pool->dense[i], ARL_NULL_ID);
+	}
+
+	// La fin du tableau est abandonnée d'un coup, le sparse n'est pas touché
+	pool->removes        += pool->transient_count;
+	pool->count          -= pool->transient_count;
+	pool->transient_count = 0;
+
+	if (! pool->bits || ! n) return;
+
+	// Bitset : on efface la plage d'IDs transitoires, mot par mot
+	uint32_t end = first + n;
+	for (uint32_t word = first >> 6; (size_t)word * 64 < end; word++) {
+		uint32_t lo = word * 64 > first ? 0 : first & 63;
+		uint32_t hi = (size_t)word * 64 + 64 <= end ? 64 : end & 63;
+		uint64_t mask = (hi == 64 ? ~(uint64_t)0 : ((uint64_t)1 << hi) - 1) & ~(((uint64_t)1 << lo) - 1);
+
+		pool->bits[word] &= ~mask;
+		if (! pool->bits[word]) pool->bits_top[word >> 6] &= ~((uint64_t)1 << (word & 63));
+	}
+}
+
+
+uint32_t arlecs_pool_reserve_slots(ArlPool* pool, uint32_t n) {
+	assert(pool->transient_count == 0 && "ArlECS Error: Concurrent adds with transient components in the pool");
+	assert(pool->hash == NULL && "ArlECS Error: Concurrent adds on a hashed pool");
+	if (pool->hash) return ARL_NULL_ID; // Sans assert : refusé plutôt qu'une table corrompue
+
+	// CAS plutôt que fetch-add : un pool plein ne doit jamais dépasser sa capacité
+	for (;;) {
+		uint32_t first = ARL_ATOMIC_LOAD_U32(&pool->count);
+		if (n > pool->dense_capacity - first) return ARL_NULL_ID;
+
+		if (ARL_ATOMIC_CAS_U32(&pool->count, first, first + n)) {
+			ARL_ATOMIC_FETCH_ADD_U64(&pool->adds, n);
+			return first;
+		}
+	}
+}
+
+
+void* arlecs_pool_emplace(ArlPool* pool, uint32_t slot, ArlEntity entity) {
+	assert(entity < pool->capacity && "ArlECS Error: Entity out of pool capacity");
+
+	pool->dense[slot] = entity;
+
+	if (pool->bits) {
+		uint32_t word = entity >> 6;
+		ARL_ATOMIC_OR_U64(&pool->bits[word], (uint64_t)1 << (entity & 63));
+		ARL_ATOMIC_OR_U64(&pool->bits_top[word >> 6], (uint64_t)1 << (word & 63));
+	}
+
+	// Table de hachage : pas de publication atomique possible, ajouts concurrents exclus
+	assert(pool->hash == NULL && "ArlECS Error: Concurrent adds on a hashed pool");
+
+	// Publication : le sparse n'est visible qu'une fois le dense écrit
+	uint8_t* entry = pool->sparse + ((size_t)entity << pool->sparse_shift);
+	if (pool->sparse_shift == 1) ARL_ATOMIC_STORE_U16((uint16_t*)(void*)entry, (uint16_t)slot);
+	else ARL_ATOMIC_STORE_U32((uint32_t*)(void*)entry, slot);
+
+	return pool->data + ((size_t)slot * pool->elem_size);
+}
+
+
+void* arlecs_pool_add_concurrent(ArlPool* pool, ArlEntity entity) {
+	if (entity >= pool->capacity) return NULL;
+
+	uint32_t slot = arlecs_pool_reserve_slots(pool, 1);
+	if (slot == ARL_NULL_ID) return NULL;
+
+	return arlecs_pool_emplace(pool, slot, entity);
+}
+
+
 void arlecs_pool_remove(ArlPool* pool, ArlEntity entity) {
-	if (entity >= pool->capacity) return;
-	
-	uint32_t index_removed = pool->sparse[entity];
+	uint32_t index_removed = arlecs_pool_index(pool, entity);
 	if (index_removed == ARL_NULL_ID) return; // Rien à supprimer
 
-	uint32_t index_last = pool->count - 1;
+	// Composant transitoire : swap & pop à l'intérieur de la zone de fin, jamais de tombe
+	uint32_t transient_start = pool->count - pool->transient_count;
+	if (index_removed >= transient_start) {
+		if (index_removed != pool->count - 1) move_slot(pool, pool->count - 1, index_removed);
+
+		index_store(pool, entity, ARL_NULL_ID);
+		pool->count--;
+		pool->transient_count--;
+		pool->removes++;
+		if (pool->bits) arlecs_pool_bit_clear(pool, entity);
+		return;
+	}
+
+	uint32_t index_last = transient_start - 1;
+
+	// Mode stable : une tombe au lieu d'un déplacement (sauf en fin de tableau)
+	if ((pool->flags & ARLECS_POOL_STABLE) && index_removed != index_last) {
+		uint8_t* slot = pool->data + ((size_t)index_removed * pool->elem_size);
+		memcpy(slot, &pool->free_head, sizeof(uint32_t));
+		pool->free_head = index_removed;
+
+		pool->tombstone_bits[index_removed >> 6] |= (uint64_t)1 << (index_removed & 63);
+		pool->tombstones++;
+
+		pool->dense[index_removed] = ARL_NULL_ENTITY;
+		index_store(pool, entity, ARL_NULL_ID);
+		pool->removes++;
+		if (pool->bits) arlecs_pool_bit_clear(pool, entity);
+		return;
+	}
 
 	// SWAP & POP : Si ce n'est pas le dernier, on déplace le dernier dans le trou
 	if (index_removed != index_last) {
-		ArlEntity entity_last = pool->dense[index_last];
-
-		// 1. Déplacer la DATA brute (memcpy) du dernier vers le trou
-		uint8_t* dst = pool->data + (index_removed * pool->elem_size);
-		uint8_t* src = pool->data + (index_last * pool->elem_size);
-		memcpy(dst, src, pool->elem_size);
+		move_slot(pool, index_last, index_removed);
+	}
 
-		// 2. Mettre à jour les liens
-		pool->dense[index_removed] = entity_last;
-		pool->sparse[entity_last]  = index_removed;
+	// La zone transitoire recule d'un slot : son dernier élément comble le trou laissé
+	if (pool->transient_count) {
+		move_slot(pool, pool->count - 1, index_last);
 	}
 
 	// Nettoyage
-	pool->sparse[entity] = ARL_NULL_ID;
+	index_store(pool, entity, ARL_NULL_ID);
 	pool->count--;
+	pool->removes++;
+	if (pool->bits) arlecs_pool_bit_clear(pool, entity);
+}
+
+
+// Passe unique à partir de 'start' : les vivants glissent vers le début, dans l'ordre.
+// Les slots morts (dense NULL) et les éléments retenus par pred disparaissent ;
+// le sparse n'est réécrit que pour les éléments déplacés ou supprimés.
+static uint32_t compact_pass(ArlPool* pool, uint32_t start, ArlPoolPredicate pred, void* ctx) {
+	uint32_t old_count = pool->count;
+	uint32_t transient_start = old_count - pool->transient_count;
+	uint32_t write = start;
+	uint32_t read = start;
+	uint32_t removed = 0;
+	uint32_t transients_gone = 0;
+	size_t stride = pool->elem_size;
+
+	while (read < old_count) {
+		// 1. Série de survivants [run, read) : déplacée d'un bloc
+		uint32_t run = read;
+		bool drop = false;
+		for (; read < old_count; read++) {
+			ArlEntity e = pool->dense[read];
+			if (e == ARL_NULL_ENTITY) break;
+			if (pred && pred(e, pool->data + (size_t)read * stride, ctx)) {
+				drop = true;
+				break;
+			}
+		}
+
+		uint32_t n = read - run;
+		if (n && run != write) {
+			memmove(pool->data + (size_t)write * stride, pool->data + (size_t)run * stride, (size_t)n * stride);
+			memmove(pool->dense + write, pool->dense + run, (size_t)n * sizeof(ArlEntity));
+			for (uint32_t i = write; i < write + n; i++) index_store(pool, pool->dense[i], i);
+			pool->swaps += n;
+		}
+		write += n;
+
+		// 2. L'élément qui a coupé la série : slot mort ou retenu par le prédicat
+		if (read < old_count) {
+			if (read >= transient_start) transients_gone++;
+			if (drop) {
+				ArlEntity e = pool->dense[read];
+				index_store(pool, e, ARL_NULL_ID);
+				if (pool->bits) arlecs_pool_bit_clear(pool, e);
+				removed++;
+			}
+			read++;
+		}
+	}
+
+	if (pool->tombstone_bits) memset(pool->tombstone_bits, 0, ((size_t)old_count + 63) / 64 * sizeof(uint64_t));
+	pool->tombstones = 0;
+	pool->free_head  = ARL_NULL_ID;
+	pool->count      = write;
+	pool->removes   += removed;
+	pool->transient_count -= transients_gone;
+
+	return removed;
+}
+
+
+// Premier slot mort d'un pool stable (count s'il n'y en a pas)
+static uint32_t first_tombstone(const ArlPool* pool) {
+	if (! pool->tombstones) return pool->count;
+
+	for (uint32_t w = 0; (size_t)w * 64 < pool->count; w++) {
+		if (pool->tombstone_bits[w]) return w * 64 + (uint32_t)ARL_CTZ64(pool->tombstone_bits[w]);
+	}
+	return pool->count;
+}
+
+
+void arlecs_pool_compact(ArlPool* pool) {
+	if (! pool->tombstones) return;
+	compact_pass(pool, first_tombstone(pool), NULL, NULL);
+}
+
+
+uint32_t arlecs_pool_remove_if(ArlPool* pool, ArlPoolPredicate pred, void* ctx) {
+	return compact_pass(pool, 0, pred, ctx);
+}
+
+
+uint32_t arlecs_pool_remove_batch(ArlPool* pool, const ArlEntity* entities, uint32_t n) {
+	// 1. Marquage : le slot devient mort, sans rien déplacer
+	uint32_t first = pool->count;
+	uint32_t removed = 0;
+
+	for (uint32_t i = 0; i < n; i++) {
+		ArlEntity e = entities[i];
+		if (e >= pool->capacity) continue;
+
+		uint32_t index = arlecs_pool_index(pool, e);
+		if (index == ARL_NULL_ID) continue; // Absent, ou doublon
+
+		index_store(pool, e, ARL_NULL_ID);
+		pool->dense[index] = ARL_NULL_ENTITY;
+		if (pool->bits) arlecs_pool_bit_clear(pool, e);
+		if (index < first) first = index;
+		removed++;
+	}
+
+	if (! removed) return 0;
+	pool->removes += removed;
+
+	// 2. Une seule passe de compactage, à partir du premier trou (ou de la première tombe)
+	uint32_t tomb = first_tombstone(pool);
+	compact_pass(pool, tomb < first ? tomb : first, NULL, NULL);
+
+	return removed;
+}
+
+
+void arlecs_pool_relocate(ArlPool* pool, uintptr_t lo, uintptr_t hi, intptr_t delta) {
+	pool->sparse = (uint8_t*)  arl_relocate_ptr(pool->sparse, lo, hi, delta);
+	pool->hash   = (ArlHashSlot*)arl_relocate_ptr(pool->hash, lo, hi, delta);
+	pool->dense  = (ArlEntity*)arl_relocate_ptr(pool->dense,  lo, hi, delta);
+	pool->data   = (uint8_t*)  arl_relocate_ptr(pool->data,   lo, hi, delta);
+	pool->tombstone_bits = (uint64_t*)arl_relocate_ptr(pool->tombstone_bits, lo, hi, delta);
+	pool->bits           = (uint64_t*)arl_relocate_ptr(pool->bits,           lo, hi, delta);
+	pool->bits_top       = (uint64_t*)arl_relocate_ptr(pool->bits_top,       lo, hi, delta);
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <ArmelECS/arlecs_prefab.h>
+
+
+void arlecs_prefab_init(ArlPrefab* prefab, Armel* arena) {
+	memset(prefab, 0, sizeof(*prefab));
+	prefab->arena = arena;
+}
+
+
+void* arlecs_prefab_add(ArlEcsWorld* world, ArlPrefab* prefab, uint32_t component_id) {
+	assert(component_id < ARLECS_MAX_COMPONENT_TYPES && world->pools[component_id] != NULL && "ArlEcs Error: Unknown component");
+
+	for (uint32_t i = 0; i < prefab->count; i++) {
+		if (prefab->ids[i] == component_id) return prefab->values[i];
+	}
+
+	assert(prefab->count < ARLECS_PREFAB_MAX_COMPONENTS && "ArlECS Error: Too many components in a prefab");
+
+	// Le modèle a la taille d'un slot du pool (stride compris) : une copie = un memcpy
+	void* value = arl_alloc_zeroed(prefab->arena, world->pools[component_id]->elem_size);
+	prefab->ids[prefab->count]    = component_id;
+	prefab->values[prefab->count] = value;
+	prefab->count++;
+
+	return value;
+}
+
+
+// Réplique le premier élément sur n slots : chaque memcpy double la zone remplie
+static void broadcast(uint8_t* dst, const void* value, size_t stride, uint32_t n) {
+	memcpy(dst, value, stride);
+
+	size_t filled = 1;
+	while (filled < n) {
+		size_t chunk = filled < n - filled ? filled : n - filled;
+		memcpy(dst + filled * stride, dst, chunk * stride);
+		filled += chunk;
+	}
+}
+
+
+ArlEntity arlecs_instantiate_ex(ArlEcsWorld* world, const ArlPrefab* prefab, uint32_t n, ArlEntity* out_ids,
+                                ArlPrefabOverride override, void* ctx) {
+	if (n == 0) return ARL_NULL_ENTITY;
+
+	// Place vérifiée dans chaque pool avant toute réservation : un refus ne laisse rien derrière lui
+	for (uint32_t i = 0; i < prefab->count; i++) {
+		const ArlPool* pool = world->pools[prefab->ids[i]];
+		if (n > pool->dense_capacity - pool->count) return ARL_NULL_ENTITY;
+	}
+
+	ArlEntity first = arlecs_reserve_entities(world, n);
+	if (first == ARL_NULL_ENTITY) return ARL_NULL_ENTITY; // Monde plein
+	void* columns[ARLECS_PREFAB_MAX_COMPONENTS];
+
+	for (uint32_t i = 0; i < prefab->count; i++) {
+		ArlPool* pool = world->pools[prefab->ids[i]];
+
+		uint8_t* dst = (uint8_t*)arlecs_pool_add_run(pool, first, n);
+		assert(dst != NULL && "ArlECS Error: Pool full");
+
+		broadcast(dst, prefab->values[i], pool->elem_size, n);
+		columns[i] = dst;
+	}
+
+	if (out_ids) {
+		for (uint32_t i = 0; i < n; i++) out_ids[i] = (ArlEntity)(first + i);
+	}
+
+	// Colonnes retouchées par l'appelant : nouvelle version pour les systèmes réactifs
+	if (override) {
+		override(world, first, n, columns, ctx);
+		for (uint32_t i = 0; i < prefab->count; i++) arlecs_pool_touch(world->pools[prefab->ids[i]]);
+	}
+
+	return first;
+}
+
+
+ArlEntity arlecs_instantiate(ArlEcsWorld* world, const ArlPrefab* prefab, uint32_t n, ArlEntity* out_ids) {
+	return arlecs_instantiate_ex(world, prefab, n, out_ids, NULL, NULL);
+}
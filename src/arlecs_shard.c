@@ -0,0 +1,113 @@
+#include <ArmelECS/arlecs_shard.h>
+#include <ArmelECS/arlecs_mem.h>
+
+
+void arlecs_shards_init(ArlShardedWorld* sw, Armel* arenas, uint32_t count, uint32_t max_entities) {
+	arlecs_shards_init_ex(sw, arenas, count, max_entities, ARLECS_MEM_DEFAULT, NULL);
+}
+
+
+void arlecs_shards_init_ex(ArlShardedWorld* sw, Armel* arenas, uint32_t count, uint32_t max_entities, uint32_t mem_flags, const int* nodes) {
+	if (count > ARLECS_MAX_SHARDS) count = ARLECS_MAX_SHARDS;
+
+	sw->count = count;
+	sw->component_counter = 0;
+
+	// Pas de threads avant arlecs_shards_start() : les shards tournent sur l'appelant
+	memset(&sw->workers, 0, sizeof(sw->workers));
+	sw->workers.count = 1;
+
+	for (uint32_t i = 0; i < count; i++) {
+		// Chaque shard sur le noeud de son thread (-1 : pas de binding)
+		sw->shards[i] = arlecs_world_create_ex(&arenas[i], max_entities, mem_flags, nodes ? nodes[i] : -1);
+	}
+}
+
+
+uint32_t arlecs_shards_start(ArlShardedWorld* sw, const int* cpus) {
+	return arlecs_workers_start(&sw->workers, sw->count, cpus);
+}
+
+
+void arlecs_shards_stop(ArlShardedWorld* sw) {
+	arlecs_workers_stop(&sw->workers);
+}
+
+
+uint32_t arlecs_shards_register_component(ArlShardedWorld* sw, size_t size) {
+	ArlPoolDesc desc = { size, ARLECS_POOL_DEFAULT, 0.0f, 0, 0 };
+	return arlecs_shards_register_component_desc(sw, &desc);
+}
+
+
+uint32_t arlecs_shards_register_component_desc(ArlShardedWorld* sw, const ArlPoolDesc* desc) {
+	uint32_t id = sw->component_counter;
+
+	for (uint32_t i = 0; i < sw->count; i++) {
+		uint32_t shard_id = arlecs_register_component_desc(sw->shards[i], desc);
+		assert(shard_id == id && "ArlECS Error: Shard registered a component on its own");
+		(void)shard_id;
+	}
+
+	sw->component_counter++;
+	return id;
+}
+
+
+ArlEntity arlecs_migrate_entity(ArlEcsWorld* src, ArlEcsWorld* dst, ArlEntity entity) {
+	assert(src->component_counter == dst->component_counter && "ArlECS Error: Shards do not share the same registry");
+
+	ArlComponentMask mask;
+	arlecs_entity_mask(src, entity, &mask);
+
+	// 1. Place vérifiée avant toute écriture : un shard plein refuse l'entité, rien ne bouge
+	if (dst->entity_counter >= dst->transient_base) return ARL_NULL_ENTITY;
+
+	for (uint32_t id = arlecs_mask_next(&mask, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(&mask, id + 1)) {
+		const ArlPool* to = dst->pools[id];
+		assert(src->pools[id]->elem_size == to->elem_size && "ArlECS Error: Shards do not share the same registry");
+		if (to->free_head == ARL_NULL_ID && to->count >= to->dense_capacity) return ARL_NULL_ENTITY;
+	}
+
+	// 2. Copie complète dans dst, puis seulement retrait de src
+	ArlEntity moved = arlecs_create_entity(dst);
+
+	for (uint32_t id = arlecs_mask_next(&mask, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(&mask, id + 1)) {
+		void* data = arlecs_pool_add(dst->pools[id], moved);
+		if (! data) {
+			// Défait les copies déjà faites : l'entité reste entière dans src
+			for (uint32_t k = arlecs_mask_next(&mask, 0); k < id; k = arlecs_mask_next(&mask, k + 1)) arlecs_pool_remove(dst->pools[k], moved);
+			return ARL_NULL_ENTITY;
+		}
+		memcpy(data, arlecs_pool_get(src->pools[id], entity), src->pools[id]->elem_size);
+	}
+
+	for (uint32_t id = arlecs_mask_next(&mask, 0); id < ARLECS_MAX_COMPONENT_TYPES; id = arlecs_mask_next(&mask, id + 1)) {
+		arlecs_pool_remove(src->pools[id], entity);
+	}
+
+	return moved;
+}
+
+
+// Le worker w prend les shards w, w + n, w + 2n... (moins de threads que de shards si un thread n'a pas démarré)
+typedef struct {
+	ArlShardedWorld* sw;
+	ArlShardFunc fn;
+	void* ctx;
+} ShardTask;
+
+static void shard_worker(uint32_t worker, void* arg) {
+	ShardTask* task = (ShardTask*)arg;
+	ArlShardedWorld* sw = task->sw;
+
+	for (uint32_t i = worker; i < sw->count; i += sw->workers.count) {
+		task->fn(sw->shards[i], i, task->ctx);
+	}
+}
+
+void arlecs_shards_run(ArlShardedWorld* sw, ArlShardFunc fn, void* ctx) {
+	// Sans threads démarrés, le worker 0 (l'appelant) fait tous les shards
+	ShardTask task = { sw, fn, ctx };
+	arlecs_workers_run(&sw->workers, shard_worker, &task);
+}
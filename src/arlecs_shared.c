@@ -0,0 +1,248 @@
+#include <ArmelECS/arlecs_shared.h>
+#include <ArmelECS/arlecs_atomic.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define ARLECS_HAS_SHARED 1
+#endif
+
+
+#ifdef ARLECS_HAS_SHARED
+
+// --- Écrivain ---
+
+bool arlecs_shared_create(ArlSharedWorld* sw, const char* name, size_t size, uint32_t max_entities) {
+	memset(sw, 0, sizeof(*sw));
+	sw->fd = -1;
+	if (strlen(name) >= sizeof(sw->name)) return false;
+
+	// O_EXCL : un segment encore publié (autre écrivain, nom resté) n'est jamais repris
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0) return false;
+
+	size = arl_align_up(size < 2 * ARLECS_SHARED_HEADER_SIZE ? 2 * ARLECS_SHARED_HEADER_SIZE : size, ARLECS_SHARED_HEADER_SIZE);
+	if (ftruncate(fd, (off_t)size) != 0) {
+		close(fd);
+		shm_unlink(name);
+		return false;
+	}
+
+	void* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		close(fd);
+		shm_unlink(name);
+		return false;
+	}
+
+	// 1. En-tête : le segment naît "en cours d'écriture" (compteur impair)
+	ArlSharedHeader* h = (ArlSharedHeader*)map;
+	uint8_t* bytes = (uint8_t*)map;
+
+	memset(h, 0, sizeof(*h));
+	h->magic          = ARLECS_SHARED_MAGIC;
+	h->version        = ARLECS_SHARED_VERSION;
+	h->world_size     = sizeof(ArlEcsWorld);
+	h->max_components = ARLECS_MAX_COMPONENT_TYPES;
+	h->size           = size;
+	h->base           = (uint64_t)(uintptr_t)map;
+	h->seq            = 1;
+
+	sw->header = h;
+	sw->size   = size;
+	sw->fd     = fd;
+	memcpy(sw->name, name, strlen(name) + 1);
+
+	// 2. Arène locale sur la zone après l'en-tête : tout le monde vit dans le segment
+	arl_new_local(&sw->arena, bytes + ARLECS_SHARED_HEADER_SIZE, size - ARLECS_SHARED_HEADER_SIZE, ARL_ALIGN, ARL_NOFLAG);
+
+	sw->world = arlecs_world_create(&sw->arena, max_entities);
+	h->world  = (uint64_t)((uintptr_t)sw->world - (uintptr_t)map);
+	return true;
+}
+
+
+void arlecs_shared_begin(ArlSharedWorld* sw) {
+	uint64_t seq = sw->header->seq;
+	assert(! (seq & 1) && "ArlECS Error: Shared frame already started");
+
+	// Compteur impair visible avant toute écriture du monde
+	ARL_ATOMIC_STORE_U64(&sw->header->seq, seq + 1);
+	ARL_ATOMIC_FENCE_RELEASE();
+}
+
+
+void arlecs_shared_publish(ArlSharedWorld* sw) {
+	uint64_t seq = sw->header->seq;
+	assert((seq & 1) && "ArlECS Error: Shared frame not started");
+
+	sw->header->frame++;
+	ARL_ATOMIC_STORE_U64(&sw->header->seq, seq + 1);
+}
+
+
+void arlecs_shared_destroy(ArlSharedWorld* sw) {
+	if (! sw->header) return;
+
+	munmap(sw->header, sw->size);
+	close(sw->fd);
+	shm_unlink(sw->name);
+
+	memset(sw, 0, sizeof(*sw));
+	sw->fd = -1;
+}
+
+
+// --- Lecteurs ---
+
+bool arlecs_shared_attach(ArlSharedReader* reader, const char* name, Armel* arena) {
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = -1;
+
+	int fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0) return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < 2 * ARLECS_SHARED_HEADER_SIZE) {
+		close(fd);
+		return false;
+	}
+
+	size_t size = (size_t)st.st_size;
+	void* map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		close(fd);
+		return false;
+	}
+
+	// Le segment vient-il de ce build ?
+	const ArlSharedHeader* h = (const ArlSharedHeader*)map;
+	if (h->magic != ARLECS_SHARED_MAGIC || h->version != ARLECS_SHARED_VERSION
+		|| h->world_size != sizeof(ArlEcsWorld) || h->max_components != ARLECS_MAX_COMPONENT_TYPES
+		|| h->size != size || h->world < ARLECS_SHARED_HEADER_SIZE || h->world + sizeof(ArlEcsWorld) > size) {
+		munmap(map, size);
+		close(fd);
+		return false;
+	}
+
+	reader->header = h;
+	reader->size   = size;
+	reader->fd     = fd;
+	reader->pools  = arl_array(arena, ArlPool, ARLECS_MAX_COMPONENT_TYPES);
+	return true;
+}
+
+
+ArlEcsWorld* arlecs_shared_read_begin(ArlSharedReader* reader) {
+	const ArlSharedHeader* h = reader->header;
+
+	uint64_t seq = ARL_ATOMIC_LOAD_U64(&h->seq);
+	if (seq & 1) return NULL; // L'écrivain est en pleine frame : on ne l'attend pas
+
+	// Adresses de l'écrivain -> adresses de notre mapping
+	const uint8_t* bytes = (const uint8_t*)h;
+	uintptr_t lo = (uintptr_t)h->base, hi = lo + reader->size;
+	intptr_t delta = (intptr_t)((uintptr_t)bytes - lo);
+
+	// 1. Copie du monde, bornes vérifiées : une copie déchirée ne doit pas nous faire sortir du segment
+	ArlEcsWorld* world = &reader->world;
+	memcpy(world, bytes + h->world, sizeof(*world));
+	if (world->component_counter > ARLECS_MAX_COMPONENT_TYPES || world->resource_counter > ARLECS_MAX_RESOURCES) return NULL;
+
+	// 2. Copie des en-têtes de pools, recalés ; les tableaux restent dans le segment
+	for (uint32_t i = 0; i < world->component_counter; i++) {
+		uintptr_t p = (uintptr_t)world->pools[i];
+		if (! p) continue;
+		if (p < lo || p + sizeof(ArlPool) > hi) return NULL;
+
+		ArlPool* pool = &reader->pools[i];
+		memcpy(pool, (const void*)(p + (uintptr_t)delta), sizeof(*pool));
+		arlecs_pool_relocate(pool, lo, hi, delta);
+		world->pools[i] = pool;
+	}
+
+	for (uint32_t i = 0; i < world->resource_counter; i++) {
+		world->resources[i] = arl_relocate_ptr(world->resources[i], lo, hi, delta);
+	}
+
+	// Pointeurs vers la mémoire du processus écrivain
+	world->arena          = NULL;
+	world->frame_scratch  = NULL;
+	world->worker_scratch = NULL;
+	world->worker_count   = 0;
+	world->slice          = NULL;
+	world->footprint      = 0;
+
+	uint64_t frame = h->frame;
+
+	// 3. Les en-têtes copiés sont cohérents si personne n'a écrit entre-temps
+	ARL_ATOMIC_FENCE_ACQUIRE();
+	if (ARL_ATOMIC_LOAD_U64(&h->seq) != seq) return NULL;
+
+	reader->seq   = seq;
+	reader->frame = frame;
+	return world;
+}
+
+
+bool arlecs_shared_read_end(const ArlSharedReader* reader) {
+	ARL_ATOMIC_FENCE_ACQUIRE();
+	return ARL_ATOMIC_LOAD_U64(&reader->header->seq) == reader->seq;
+}
+
+
+void arlecs_shared_detach(ArlSharedReader* reader) {
+	if (! reader->header) return;
+
+	munmap((void*)reader->header, reader->size);
+	close(reader->fd);
+
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = -1;
+}
+
+#else
+
+bool arlecs_shared_create(ArlSharedWorld* sw, const char* name, size_t size, uint32_t max_entities) {
+	(void)name; (void)size; (void)max_entities;
+	memset(sw, 0, sizeof(*sw));
+	sw->fd = -1;
+	return false;
+}
+
+void arlecs_shared_begin(ArlSharedWorld* sw) {
+	(void)sw;
+}
+
+void arlecs_shared_publish(ArlSharedWorld* sw) {
+	(void)sw;
+}
+
+void arlecs_shared_destroy(ArlSharedWorld* sw) {
+	(void)sw;
+}
+
+bool arlecs_shared_attach(ArlSharedReader* reader, const char* name, Armel* arena) {
+	(void)name; (void)arena;
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = -1;
+	return false;
+}
+
+ArlEcsWorld* arlecs_shared_read_begin(ArlSharedReader* reader) {
+	(void)reader;
+	return NULL;
+}
+
+bool arlecs_shared_read_end(const ArlSharedReader* reader) {
+	(void)reader;
+	return false;
+}
+
+void arlecs_shared_detach(ArlSharedReader* reader) {
+	(void)reader;
+}
+
+#endif
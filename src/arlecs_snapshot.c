@@ -0,0 +1,71 @@
+#include <ArmelECS/arlecs_snapshot.h>
+
+
+// Modulo à préserver : 64 octets, ou plus si une pool est plus alignée (128, page...)
+static size_t snapshot_align(const ArlEcsWorld* world) {
+	return world->max_align > ARLECS_SNAPSHOT_ALIGN ? world->max_align : ARLECS_SNAPSHOT_ALIGN;
+}
+
+
+size_t arlecs_world_footprint(const ArlEcsWorld* world) {
+	// Un clone connaît sa taille, un monde vivant va jusqu'au curseur de son arène
+	if (world->footprint) return world->footprint;
+
+	return (uintptr_t)world->arena->cursor - (uintptr_t)world;
+}
+
+
+ArlEcsWorld* arlecs_world_clone_into(ArlEcsWorld* world, Armel* dst_arena) {
+	assert(world->arena->prev == NULL && "ArlECS Error: Snapshots require a non-chained arena");
+
+	size_t size = arlecs_world_footprint(world);
+	size_t align = snapshot_align(world);
+	uintptr_t src = (uintptr_t)world;
+
+	// Même décalage modulo l'alignement que l'original : chaque pool reste alignée
+	uint8_t* raw = (uint8_t*)arl_alloc(dst_arena, size + 2 * align);
+	if (! raw) return NULL;
+
+	uintptr_t dst = arl_align_up((uintptr_t)raw, align) + (src & (align - 1));
+
+	memcpy((void*)dst, world, size);
+
+	ArlEcsWorld* clone = (ArlEcsWorld*)dst;
+	arlecs_world_relocate(clone, src, src + size, (intptr_t)(dst - src));
+
+	clone->arena = dst_arena;
+	clone->footprint = size;
+
+	return clone;
+}
+
+
+void arlecs_world_restore(ArlEcsWorld* world, const ArlEcsWorld* snapshot) {
+	assert(world->footprint == 0 && "ArlECS Error: Restore target must be a live world");
+	assert(snapshot->footprint != 0 && "ArlECS Error: Restore source must be a snapshot");
+
+	Armel* arena = world->arena;
+	size_t size = snapshot->footprint;
+	uintptr_t src = (uintptr_t)snapshot;
+	uintptr_t dst = (uintptr_t)world;
+	assert(((src ^ dst) & (snapshot_align(snapshot) - 1)) == 0 && "ArlECS Error: Snapshot from another world");
+	assert(dst + size <= (uintptr_t)arena->end && "ArlECS Error: Snapshot larger than the world arena");
+
+	// Ce qui appartient au monde vivant et pas à l'état sauvegardé
+	Armel* frame_scratch  = world->frame_scratch;
+	Armel* worker_scratch = world->worker_scratch;
+	uint32_t worker_count = world->worker_count;
+	struct ArlSlice* slice = world->slice;
+
+	memcpy(world, snapshot, size);
+	arlecs_world_relocate(world, src, src + size, (intptr_t)(dst - src));
+
+	world->arena          = arena;
+	world->footprint      = 0;
+	world->frame_scratch  = frame_scratch;
+	world->worker_scratch = worker_scratch;
+	world->worker_count   = worker_count;
+	world->slice          = slice;
+
+	arl_rewind_to(arena, dst + size - (uintptr_t)arena->base);
+}
@@ -0,0 +1,367 @@
+#include <ArmelECS/arlecs_spatial.h>
+#include <math.h> // NAN
+
+
+// Position d'un élément du pool (floats en tête du composant)
+static inline const float* pool_position(const ArlPool* pool, uint32_t index) {
+	return (const float*)(pool->data + (size_t)index * pool->elem_size);
+}
+
+
+// Coordonnée de cellule sur un axe, bornée à la grille
+static inline uint32_t axis_cell(const ArlSpatialGrid* grid, uint32_t axis, float value) {
+	float f = (value - grid->origin[axis]) * grid->inv_cell;
+	if (! (f > 0.0f)) return 0; // Négatif ou NaN
+	uint32_t c = f >= (float)grid->cells[axis] ? grid->cells[axis] - 1 : (uint32_t)f;
+	return c;
+}
+
+
+static inline uint32_t cell_of(const ArlSpatialGrid* grid, const float* pos) {
+	uint32_t x = axis_cell(grid, 0, pos[0]);
+	uint32_t y = axis_cell(grid, 1, pos[1]);
+	uint32_t z = grid->dims == 3 ? axis_cell(grid, 2, pos[2]) : 0;
+	return x + grid->cells[0] * (y + grid->cells[1] * z);
+}
+
+
+// Écrit une entité dans un emplacement du tableau trié
+static inline void place(ArlSpatialGrid* grid, uint32_t slot, ArlEntity e, const float* pos) {
+	grid->entities[slot] = e;
+	memcpy(grid->positions + (size_t)slot * grid->dims, pos, grid->dims * sizeof(float));
+	grid->entity_slot[e] = slot;
+}
+
+
+ArlSpatialGrid* arlecs_spatial_create(ArlEcsWorld* world, uint32_t component_id, uint32_t dims,
+                                      const float* min, const float* max, float cell_size) {
+	assert((dims == 2 || dims == 3) && "ArlECS Error: Spatial index supports 2D or 3D positions");
+	assert(component_id < world->component_counter && world->pools[component_id] && "ArlEcs Error: Unknown component");
+	assert(world->pools[component_id]->elem_size >= dims * sizeof(float) && "ArlECS Error: Position component too small");
+	assert(cell_size > 0.0f && "ArlECS Error: Invalid cell size");
+
+	Armel* arena = world->arena;
+	ArlSpatialGrid* grid = arl_make(arena, ArlSpatialGrid);
+
+	grid->world = world;
+	grid->component_id = component_id;
+	grid->dims = dims;
+	grid->cell_size = cell_size;
+	grid->inv_cell = 1.0f / cell_size;
+	grid->cell_count = 1;
+
+	for (uint32_t d = 0; d < 3; d++) {
+		if (d < dims) {
+			float extent = max[d] - min[d];
+			grid->origin[d] = min[d];
+			grid->cells[d] = extent > 0.0f ? (uint32_t)(extent / cell_size) + 1 : 1;
+		} else {
+			grid->origin[d] = 0.0f;
+			grid->cells[d] = 1;
+		}
+		grid->cell_count *= grid->cells[d];
+	}
+
+	grid->capacity = world->max_entities;
+	grid->count = 0;
+	grid->end = 0;
+	grid->holes = 0;
+
+	grid->cell_start  = arl_array(arena, uint32_t, grid->cell_count + 2);
+	grid->entities    = arl_array(arena, ArlEntity, grid->capacity);
+	grid->positions   = arl_array(arena, float, (size_t)grid->capacity * dims);
+	grid->entity_cell = arl_array(arena, uint32_t, grid->capacity);
+	grid->entity_slot = arl_array(arena, uint32_t, grid->capacity);
+
+	memset(grid->cell_start, 0, (grid->cell_count + 2) * sizeof(uint32_t));
+	memset(grid->entity_cell, 0xFF, (size_t)grid->capacity * sizeof(uint32_t));
+
+	return grid;
+}
+
+
+// Oublie les entités indexées (O(slots utilisés), pas O(capacity))
+static void forget_all(ArlSpatialGrid* grid) {
+	for (uint32_t i = 0; i < grid->end; i++) {
+		if (grid->entities[i] != ARL_NULL_ENTITY) grid->entity_cell[grid->entities[i]] = ARL_NULL_ID;
+	}
+	grid->count = 0;
+	grid->end = 0;
+	grid->holes = 0;
+}
+
+
+void arlecs_spatial_rebuild(ArlSpatialGrid* grid) {
+	const ArlPool* pool = grid->world->pools[grid->component_id];
+	uint32_t* start = grid->cell_start;
+	const uint32_t cells = grid->cell_count;
+
+	forget_all(grid);
+	memset(start, 0, (cells + 2) * sizeof(uint32_t));
+
+	// 1. Histogramme (décalé de 2 pour le tri par comptage en place)
+	uint32_t indexed = 0;
+	for (uint32_t i = 0; i < pool->count; i++) {
+		ArlEntity e = pool->dense[i];
+		if (e == ARL_NULL_ENTITY) continue; // Tombe d'un pool stable
+		uint32_t c = cell_of(grid, pool_position(pool, i));
+		grid->entity_cell[e] = c;
+		start[c + 2]++;
+		indexed++;
+	}
+
+	// 2. Sommes préfixes : start[c + 1] = début de la cellule c
+	for (uint32_t c = 2; c < cells + 2; c++) start[c] += start[c - 1];
+
+	// 3. Dispersion : start[c + 1] avance jusqu'au début de la cellule c + 1
+	for (uint32_t i = 0; i < pool->count; i++) {
+		ArlEntity e = pool->dense[i];
+		if (e == ARL_NULL_ENTITY) continue;
+		uint32_t slot = start[grid->entity_cell[e] + 1]++;
+		place(grid, slot, e, pool_position(pool, i));
+	}
+
+	grid->count = indexed;
+	grid->end = indexed;
+}
+
+
+// --- Reconstruction parallèle ---
+
+typedef struct {
+	ArlSpatialGrid* grid;
+	const ArlPool* pool;
+	uint32_t workers;
+	uint32_t chunk;    // Éléments du pool par worker
+	uint32_t* hists;   // [workers * cell_count] : compte, puis curseur de dispersion
+	int phase;
+} SpatialJob;
+
+static void spatial_worker(uint32_t worker, void* ctx) {
+	SpatialJob* job = (SpatialJob*)ctx;
+	ArlSpatialGrid* grid = job->grid;
+	const ArlPool* pool = job->pool;
+	uint32_t* hist = job->hists + (size_t)worker * grid->cell_count;
+
+	uint32_t begin = worker * job->chunk;
+	uint32_t end = begin + job->chunk < pool->count ? begin + job->chunk : pool->count;
+
+	for (uint32_t i = begin; i < end; i++) {
+		ArlEntity e = pool->dense[i];
+		if (e == ARL_NULL_ENTITY) continue;
+
+		if (job->phase == 0) {
+			uint32_t c = cell_of(grid, pool_position(pool, i));
+			grid->entity_cell[e] = c;
+			hist[c]++;
+		} else {
+			uint32_t slot = hist[grid->entity_cell[e]]++;
+			place(grid, slot, e, pool_position(pool, i));
+		}
+	}
+}
+
+void arlecs_spatial_rebuild_parallel(ArlSpatialGrid* grid, ArlWorkerPool* workers, Armel* scratch) {
+	const ArlPool* pool = grid->world->pools[grid->component_id];
+	const uint32_t cells = grid->cell_count;
+	if (! scratch) scratch = grid->world->frame_scratch;
+
+	uint32_t n = workers ? workers->count : 1;
+	if (n <= 1 || ! scratch || pool->count < n * 1024) {
+		arlecs_spatial_rebuild(grid);
+		return;
+	}
+
+	// Histogrammes par worker, en mémoire temporaire (jamais dans l'arène du monde)
+	uintptr_t mark = arl_offset(scratch);
+	uint32_t* hists = (uint32_t*)arl_alloc(scratch, (size_t)n * cells * sizeof(uint32_t));
+	if (! hists) {
+		arlecs_spatial_rebuild(grid);
+		return;
+	}
+	memset(hists, 0, (size_t)n * cells * sizeof(uint32_t));
+
+	forget_all(grid);
+
+	SpatialJob job = { grid, pool, n, (pool->count + n - 1) / n, hists, 0 };
+
+	// 1. Histogrammes locaux
+	arlecs_workers_run(workers, spatial_worker, &job);
+
+	// 2. Début de chaque cellule, et curseur de chaque worker dans la cellule
+	uint32_t running = 0;
+	for (uint32_t c = 0; c < cells; c++) {
+		grid->cell_start[c] = running;
+		for (uint32_t t = 0; t < n; t++) {
+			uint32_t* h = &hists[(size_t)t * cells + c];
+			uint32_t k = *h;
+			*h = running;
+			running += k;
+		}
+	}
+	grid->cell_start[cells] = running;
+	grid->cell_start[cells + 1] = running;
+
+	// 3. Dispersion (chaque worker écrit dans ses propres emplacements)
+	job.phase = 1;
+	arlecs_workers_run(workers, spatial_worker, &job);
+
+	grid->count = running;
+	grid->end = running;
+	arl_rewind_to(scratch, mark);
+}
+
+
+// --- Mise à jour incrémentale ---
+
+// Retire une entité : trou dans la partie triée, ou le dernier de la queue prend sa place
+static void drop(ArlSpatialGrid* grid, ArlEntity e) {
+	uint32_t slot = grid->entity_slot[e];
+
+	if (slot >= grid->cell_start[grid->cell_count]) {
+		uint32_t last = --grid->end;
+		if (slot != last) place(grid, slot, grid->entities[last], grid->positions + (size_t)last * grid->dims);
+	} else {
+		// Position NaN : le trou échoue tous les tests de distance ou de boîte
+		float* p = grid->positions + (size_t)slot * grid->dims;
+		for (uint32_t d = 0; d < grid->dims; d++) p[d] = NAN;
+		grid->entities[slot] = ARL_NULL_ENTITY;
+		grid->holes++;
+	}
+
+	grid->entity_cell[e] = ARL_NULL_ID;
+	grid->count--;
+}
+
+// Trous + queue : ce que chaque requête paie en plus, et ce que la reconstruction rembourse
+static bool needs_rebuild(const ArlSpatialGrid* grid) {
+	uint32_t debt = grid->holes + (grid->end - grid->cell_start[grid->cell_count]);
+	return debt > (uint32_t)((float)grid->count * ARLECS_SPATIAL_SLACK) + ARLECS_SPATIAL_SLACK_MIN;
+}
+
+void arlecs_spatial_update(ArlSpatialGrid* grid, const ArlEntity* changed, uint32_t n) {
+	const ArlPool* pool = grid->world->pools[grid->component_id];
+
+	for (uint32_t k = 0; k < n; k++) {
+		ArlEntity e = changed[k];
+		if (e >= grid->capacity) continue;
+
+		uint32_t index = arlecs_pool_index(pool, e);
+		uint32_t old = grid->entity_cell[e];
+
+		if (index == ARL_NULL_ID) {
+			if (old != ARL_NULL_ID) drop(grid, e); // Plus de position
+			continue;
+		}
+
+		const float* pos = pool_position(pool, index);
+		uint32_t c = cell_of(grid, pos);
+
+		// Même cellule, ou déjà dans la queue : mise à jour sur place
+		if (old != ARL_NULL_ID && (c == old || grid->entity_slot[e] >= grid->cell_start[grid->cell_count])) {
+			memcpy(grid->positions + (size_t)grid->entity_slot[e] * grid->dims, pos, grid->dims * sizeof(float));
+			grid->entity_cell[e] = c;
+			continue;
+		}
+
+		if (old != ARL_NULL_ID) drop(grid, e);
+
+		// Plus de place derrière la queue : la reconstruction (depuis le pool) inclut déjà e
+		if (grid->end == grid->capacity) {
+			arlecs_spatial_rebuild(grid);
+			continue;
+		}
+
+		place(grid, grid->end++, e, pos);
+		grid->entity_cell[e] = c;
+		grid->count++;
+	}
+
+	if (needs_rebuild(grid)) arlecs_spatial_rebuild(grid);
+}
+
+
+// --- Requêtes ---
+
+uint32_t arlecs_spatial_query_aabb(const ArlSpatialGrid* grid, const float* min, const float* max,
+                                   ArlSpatialSpan* spans, uint32_t max_spans) {
+	uint32_t lo[3] = { 0, 0, 0 }, hi[3] = { 0, 0, 0 };
+	for (uint32_t d = 0; d < grid->dims; d++) {
+		lo[d] = axis_cell(grid, d, min[d]);
+		hi[d] = axis_cell(grid, d, max[d]);
+	}
+
+	uint32_t total = 0;
+	const uint32_t nx = grid->cells[0], ny = grid->cells[1];
+
+	// Les cellules d'une ligne sont contiguës : un seul span par ligne
+	for (uint32_t z = lo[2]; z <= hi[2]; z++) {
+		for (uint32_t y = lo[1]; y <= hi[1]; y++) {
+			uint32_t row = nx * (y + ny * z);
+			uint32_t begin = grid->cell_start[row + lo[0]];
+			uint32_t end = grid->cell_start[row + hi[0] + 1];
+			if (end == begin) continue;
+
+			if (total < max_spans) {
+				spans[total].entities = grid->entities + begin;
+				spans[total].positions = grid->positions + (size_t)begin * grid->dims;
+				spans[total].count = end - begin;
+			}
+			total++;
+		}
+	}
+
+	// Queue non triée : un dernier span, sans filtre de cellule
+	uint32_t sorted = grid->cell_start[grid->cell_count];
+	if (grid->end > sorted) {
+		if (total < max_spans) {
+			spans[total].entities = grid->entities + sorted;
+			spans[total].positions = grid->positions + (size_t)sorted * grid->dims;
+			spans[total].count = grid->end - sorted;
+		}
+		total++;
+	}
+
+	return total;
+}
+
+// Test exact sur les positions copiées, sans toucher au pool
+static uint32_t radius_scan(const ArlSpatialGrid* grid, uint32_t begin, uint32_t end, const float* center, float radius,
+                            ArlEntity* out, uint32_t max_out, uint32_t found) {
+	const float r2 = radius * radius;
+	const uint32_t dims = grid->dims;
+
+	for (uint32_t i = begin; i < end; i++) {
+		const float* p = grid->positions + (size_t)i * dims;
+		float dx = p[0] - center[0], dy = p[1] - center[1];
+		float dz = dims == 3 ? p[2] - center[2] : 0.0f;
+
+		if (dx * dx + dy * dy + dz * dz <= r2) {
+			if (found < max_out) out[found] = grid->entities[i];
+			found++;
+		}
+	}
+	return found;
+}
+
+uint32_t arlecs_spatial_query_radius(const ArlSpatialGrid* grid, const float* center, float radius,
+                                     ArlEntity* out, uint32_t max_out) {
+	uint32_t lo[3] = { 0, 0, 0 }, hi[3] = { 0, 0, 0 };
+	for (uint32_t d = 0; d < grid->dims; d++) {
+		lo[d] = axis_cell(grid, d, center[d] - radius);
+		hi[d] = axis_cell(grid, d, center[d] + radius);
+	}
+
+	const uint32_t nx = grid->cells[0], ny = grid->cells[1];
+	uint32_t found = 0;
+
+	for (uint32_t z = lo[2]; z <= hi[2]; z++) {
+		for (uint32_t y = lo[1]; y <= hi[1]; y++) {
+			uint32_t row = nx * (y + ny * z);
+			found = radius_scan(grid, grid->cell_start[row + lo[0]], grid->cell_start[row + hi[0] + 1], center, radius, out, max_out, found);
+		}
+	}
+
+	// Queue non triée, puis rien d'autre : les trous (NaN) échouent le test
+	return radius_scan(grid, grid->cell_start[grid->cell_count], grid->end, center, radius, out, max_out, found);
+}
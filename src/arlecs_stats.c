@@ -0,0 +1,148 @@
+#include <ArmelECS/arlecs_stats.h>
+#include <ArmelECS/arlecs_mem.h>
+
+
+void arlecs_pool_stats(const ArlPool* pool, Armel* scratch, uint32_t peak_entities, ArlPoolStats* out) {
+	const uint32_t entries_per_page = ARLECS_STATS_PAGE_SIZE >> pool->sparse_shift;
+	const size_t entry_size = (size_t)1 << pool->sparse_shift;
+
+	out->component_id = 0;
+	out->elem_size    = pool->elem_size;
+	out->count        = arlecs_pool_size(pool);
+	out->tombstones   = pool->tombstones;
+	out->capacity     = pool->dense_capacity;
+	out->index_bits   = 8u << pool->sparse_shift;
+
+	out->sparse_bytes = (size_t)pool->capacity * entry_size;
+	out->dense_bytes  = (size_t)pool->dense_capacity * sizeof(ArlEntity);
+	out->data_bytes   = (size_t)pool->dense_capacity * pool->elem_size;
+
+	// Slots libres + entrées du sparse au-delà de la plus grande entité
+	uint32_t unused_sparse = peak_entities < pool->capacity ? pool->capacity - peak_entities : 0;
+	out->wasted_bytes = (size_t)(pool->dense_capacity - arlecs_pool_size(pool)) * (sizeof(ArlEntity) + pool->elem_size)
+	                  + (size_t)unused_sparse * entry_size;
+
+	out->adds    = pool->adds;
+	out->removes = pool->removes;
+	out->swaps   = pool->swaps;
+	out->touches = pool->touches;
+
+	out->mem_flags = pool->mem_flags;
+
+	// Pool haché : la table remplace le sparse, toutes ses pages servent
+	if (pool->hash) {
+		size_t table_bytes = ((size_t)pool->hash_mask + 1) * sizeof(ArlHashSlot);
+		out->index_bits        = 32;
+		out->sparse_bytes      = table_bytes;
+		out->wasted_bytes      = (size_t)(pool->dense_capacity - arlecs_pool_size(pool)) * (sizeof(ArlEntity) + pool->elem_size);
+		out->sparse_pages      = (uint32_t)((table_bytes + ARLECS_STATS_PAGE_SIZE - 1) / ARLECS_STATS_PAGE_SIZE);
+		out->sparse_pages_used = pool->count ? out->sparse_pages : 0;
+		out->pages_counted     = true;
+		return;
+	}
+
+	// Occupation des pages du sparse : un bit par page, mémoire temporaire
+	uint32_t pages = (pool->capacity + entries_per_page - 1) / entries_per_page;
+	out->sparse_pages      = pages;
+	out->sparse_pages_used = 0;
+	out->pages_counted     = false;
+
+	// Sans mémoire temporaire, l'occupation reste inconnue
+	if (! scratch) {
+		out->sparse_pages_used = ARL_NULL_ID;
+		return;
+	}
+
+	uintptr_t mark = arl_offset(scratch);
+	uint8_t* touched = (uint8_t*)arl_alloc_zeroed(scratch, pages);
+	if (! touched) {
+		out->sparse_pages_used = ARL_NULL_ID;
+		arl_rewind_to(scratch, mark);
+		return;
+	}
+
+	for (uint32_t i = 0; i < pool->count; i++) {
+		if (pool->dense[i] == ARL_NULL_ENTITY) continue; // Tombe
+		uint32_t page = pool->dense[i] / entries_per_page;
+		out->sparse_pages_used += ! touched[page];
+		touched[page] = 1;
+	}
+
+	out->pages_counted = true;
+	arl_rewind_to(scratch, mark);
+}
+
+
+void arlecs_world_stats(ArlEcsWorld* world, Armel* scratch, ArlWorldStats* out) {
+	// Jamais l'arène du monde : elle peut être chaînée, persistée, partagée, ou absente (lecteur)
+	if (! scratch) scratch = world->frame_scratch;
+	Armel* arena = world->arena;
+
+	out->max_entities     = world->max_entities;
+	out->created_entities = world->entity_counter;
+	out->peak_entity_id   = world->entity_counter ? world->entity_counter - 1 : ARL_NULL_ID;
+	out->pools_bytes      = 0;
+	out->wasted_bytes     = 0;
+	out->arena_used       = arena ? arl_used(arena) : 0;
+	out->arena_capacity   = arena ? (uintptr_t)arena->end - (uintptr_t)arena->base : 0;
+	out->pool_count       = 0;
+
+	// Entités vivantes : un bit par entité, marqué par chaque pool
+	uintptr_t mark = scratch ? arl_offset(scratch) : 0;
+	uint64_t* alive = scratch ? (uint64_t*)arl_alloc_zeroed(scratch, ((size_t)world->entity_counter + 63) / 64 * sizeof(uint64_t)) : NULL;
+
+	for (uint32_t id = 0; id < world->component_counter; id++) {
+		ArlPool* pool = world->pools[id];
+		if (! pool) continue;
+
+		ArlPoolStats* ps = &out->pools[out->pool_count++];
+		arlecs_pool_stats(pool, scratch, world->entity_counter, ps);
+		ps->component_id = id;
+
+		out->pools_bytes  += ps->sparse_bytes + ps->dense_bytes + ps->data_bytes;
+		out->wasted_bytes += ps->wasted_bytes;
+
+		if (! alive) continue;
+		for (uint32_t i = 0; i < pool->count; i++) {
+			ArlEntity e = pool->dense[i];
+			if (e < world->entity_counter) alive[e >> 6] |= (uint64_t)1 << (e & 63);
+		}
+	}
+
+	// Sans mémoire temporaire, le compte reste inconnu
+	out->live_counted  = alive != NULL;
+	out->live_entities = alive ? 0 : ARL_NULL_ID;
+	for (size_t w = 0; alive && w < ((size_t)world->entity_counter + 63) / 64; w++) {
+		out->live_entities += ARL_POPCOUNT64(alive[w]);
+	}
+
+	if (scratch) arl_rewind_to(scratch, mark);
+}
+
+
+void arlecs_print_stats(const ArlWorldStats* stats) {
+	// Comptes non calculés (pas de scratch) : un tiret plutôt que ARL_NULL_ID
+	char live[16] = "-";
+	if (stats->live_counted) snprintf(live, sizeof(live), "%u", stats->live_entities);
+
+	printf("ArlECS World\n");
+	printf("  Entities : %s live / %u created / %u max\n",
+		live, stats->created_entities, stats->max_entities);
+	printf("  Pools    : %zu bytes reserved, %zu bytes wasted\n", stats->pools_bytes, stats->wasted_bytes);
+	printf("  Arena    : %zu / %zu bytes used\n", stats->arena_used, stats->arena_capacity);
+
+	for (uint32_t i = 0; i < stats->pool_count; i++) {
+		const ArlPoolStats* p = &stats->pools[i];
+		char used[16] = "-";
+		if (p->pages_counted) snprintf(used, sizeof(used), "%u", p->sparse_pages_used);
+
+		printf("  [%3u] size %4zu | %8u / %-8u | sparse %9zu dense %9zu data %10zu | pages %6s / %-6u"
+		       " | add %llu rem %llu swap %llu%s%s\n",
+			p->component_id, p->elem_size, p->count, p->capacity,
+			p->sparse_bytes, p->dense_bytes, p->data_bytes,
+			used, p->sparse_pages,
+			(unsigned long long)p->adds, (unsigned long long)p->removes, (unsigned long long)p->swaps,
+			(p->mem_flags & ARLECS_MEM_HUGEPAGES) ? " | huge" : "",
+			(p->mem_flags & ARLECS_MEM_NUMA) ? " | numa" : "");
+	}
+}
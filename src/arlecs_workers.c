@@ -0,0 +1,129 @@
+#if defined(__linux__) && ! defined(_GNU_SOURCE)
+	#define _GNU_SOURCE // pthread_setaffinity_np
+#endif
+
+#include <ArmelECS/arlecs_workers.h>
+#include <string.h>
+
+#ifdef __linux__
+	#include <sched.h>
+#endif
+
+
+#ifndef _WIN32
+
+static void* worker_main(void* arg) {
+	ArlWorkerSlot* slot = (ArlWorkerSlot*)arg;
+	ArlWorkerPool* wp = slot->pool;
+	uint64_t seen = 0;
+
+	pthread_mutex_lock(&wp->lock);
+	for (;;) {
+		while (! wp->stop && wp->generation == seen) pthread_cond_wait(&wp->wake, &wp->lock);
+		if (wp->stop) break;
+
+		seen = wp->generation;
+		ArlWorkerFunc fn = wp->fn;
+		void* ctx = wp->ctx;
+
+		pthread_mutex_unlock(&wp->lock);
+		fn(slot->index, ctx);
+		pthread_mutex_lock(&wp->lock);
+
+		if (--wp->pending == 0) pthread_cond_signal(&wp->done);
+	}
+	pthread_mutex_unlock(&wp->lock);
+	return NULL;
+}
+
+
+uint32_t arlecs_workers_start(ArlWorkerPool* wp, uint32_t count, const int* cpus) {
+	memset(wp, 0, sizeof(*wp));
+	if (count < 1) count = 1;
+	if (count > ARLECS_MAX_WORKER_THREADS) count = ARLECS_MAX_WORKER_THREADS;
+
+	pthread_mutex_init(&wp->lock, NULL);
+	pthread_cond_init(&wp->wake, NULL);
+	pthread_cond_init(&wp->done, NULL);
+	wp->started = true;
+	wp->count = 1;
+
+	for (uint32_t i = 1; i < count; i++) {
+		wp->slots[i] = (ArlWorkerSlot){ wp, i };
+		if (pthread_create(&wp->threads[i], NULL, worker_main, &wp->slots[i]) != 0) break;
+
+#ifdef __linux__
+		// Épinglé une fois pour toutes : le worker reste près de sa mémoire
+		if (cpus && cpus[i] >= 0 && cpus[i] < CPU_SETSIZE) {
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpus[i], &set);
+			pthread_setaffinity_np(wp->threads[i], sizeof(set), &set);
+		}
+#else
+		(void)cpus;
+#endif
+		wp->count++;
+	}
+	return wp->count;
+}
+
+
+void arlecs_workers_run(ArlWorkerPool* wp, ArlWorkerFunc fn, void* ctx) {
+	if (! wp->started || wp->count <= 1) {
+		for (uint32_t i = 0; i < wp->count; i++) fn(i, ctx);
+		return;
+	}
+
+	pthread_mutex_lock(&wp->lock);
+	wp->fn = fn;
+	wp->ctx = ctx;
+	wp->pending = wp->count - 1;
+	wp->generation++;
+	pthread_cond_broadcast(&wp->wake);
+	pthread_mutex_unlock(&wp->lock);
+
+	// Le worker 0 est l'appelant
+	fn(0, ctx);
+
+	pthread_mutex_lock(&wp->lock);
+	while (wp->pending) pthread_cond_wait(&wp->done, &wp->lock);
+	pthread_mutex_unlock(&wp->lock);
+}
+
+
+void arlecs_workers_stop(ArlWorkerPool* wp) {
+	if (! wp->started) return;
+
+	pthread_mutex_lock(&wp->lock);
+	wp->stop = true;
+	pthread_cond_broadcast(&wp->wake);
+	pthread_mutex_unlock(&wp->lock);
+
+	for (uint32_t i = 1; i < wp->count; i++) pthread_join(wp->threads[i], NULL);
+
+	pthread_mutex_destroy(&wp->lock);
+	pthread_cond_destroy(&wp->wake);
+	pthread_cond_destroy(&wp->done);
+	wp->started = false;
+	wp->count = 1;
+}
+
+#else
+
+uint32_t arlecs_workers_start(ArlWorkerPool* wp, uint32_t count, const int* cpus) {
+	(void)count; (void)cpus;
+	memset(wp, 0, sizeof(*wp));
+	wp->count = 1;
+	return 1;
+}
+
+void arlecs_workers_run(ArlWorkerPool* wp, ArlWorkerFunc fn, void* ctx) {
+	for (uint32_t i = 0; i < wp->count; i++) fn(i, ctx);
+}
+
+void arlecs_workers_stop(ArlWorkerPool* wp) {
+	wp->count = 1;
+}
+
+#endif
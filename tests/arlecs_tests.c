@@ -1,5 +1,21 @@
 #include <ArmelECS/arlecs.h>
+#include <ArmelECS/arlecs_system.h>
+#include <ArmelECS/arlecs_typed.h>
+#include <ArmelECS/arlecs_stats.h>
+#include <ArmelECS/arlecs_snapshot.h>
+#include <ArmelECS/arlecs_delta.h>
+#include <ArmelECS/arlecs_shard.h>
+#include <ArmelECS/arlecs_spatial.h>
+#include <ArmelECS/arlecs_persist.h>
+#include <ArmelECS/arlecs_loader.h>
+#include <ArmelECS/arlecs_prefab.h>
+#include <ArmelECS/arlecs_shared.h>
+#include <ArmelECS/arlecs_mem.h>
 #include <Armel/armel_test.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // --- FIXTURES (Test data) ---
 
@@ -133,6 +149,12 @@ typedef struct { float x, y; } Pos;
 typedef struct { float vx, vy; } Vel;
 typedef struct { int hp; } Health;
 
+ARL_COMPONENT_DECLARE(Pos)
+ARL_COMPONENT_DECLARE(Vel)
+ARL_VIEW_DECLARE(PosView, Pos)
+ARL_VIEW_DECLARE(PosVelView, Pos, Vel)
+ARL_VIEW_DECLARE(PosVelHpView, Pos, Vel, Health)
+
 // --- TESTS WORLD ---
 
 ARMEL_TEST(test_world_lifecycle) {
@@ -257,7 +279,1737 @@ ARMEL_TEST(test_view_removal_safety) {
 	arl_free(&arena);
 }
 
+ARMEL_TEST(test_typed_view) {
+	Armel arena;
+	arl_new(&arena, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 100);
+
+	COMP_POS    = arlecs_component_new(world, Pos);
+	COMP_VEL    = arlecs_component_new(world, Vel);
+	COMP_HEALTH = arlecs_component_new(world, Health);
+
+	// 10 entités avec POS, une sur deux avec VEL, une sur quatre avec HP
+	for (int i = 0; i < 10; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+		if (i % 2 == 0) Vel_add(world, e, COMP_VEL)->vx = 1.0f;
+		if (i % 4 == 0) ((Health*)arlecs_add_component(world, e, COMP_HEALTH))->hp = i;
+	}
+
+	assert(Pos_get(world, 3, COMP_POS)->x == 3.0f);
+	assert(Vel_get(world, 3, COMP_VEL) == NULL);
+
+	int count = 0;
+	PosView v1 = PosView_begin(world, COMP_POS);
+	while (PosView_next(&v1)) count++;
+	assert(count == 10);
+
+	count = 0;
+	PosVelView v2 = PosVelView_begin(world, COMP_POS, COMP_VEL);
+	while (PosVelView_next(&v2)) {
+		assert(v2.entity % 2 == 0);
+		assert(v2.c0 == arlecs_get_component(world, v2.entity, COMP_POS));
+		v2.c0->x += v2.c1->vx;
+		count++;
+	}
+	assert(count == 5);
+	assert(Pos_get(world, 4, COMP_POS)->x == 5.0f);
+
+	count = 0;
+	PosVelHpView v3 = PosVelHpView_begin(world, COMP_POS, COMP_VEL, COMP_HEALTH);
+	while (PosVelHpView_next(&v3)) {
+		assert(v3.c2->hp == (int)v3.entity);
+		count++;
+	}
+	assert(count == 3); // 0, 4, 8
+
+	arl_free(&arena);
+}
+
+ARMEL_TEST(test_many_components_mask) {
+	Armel arena;
+	arl_new(&arena, 16 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 16);
+
+	// Bien au-delà de l'ancienne limite de 32 composants
+	uint32_t ids[130];
+	for (int i = 0; i < 130; i++) {
+		ids[i] = arlecs_component_new(world, Health);
+	}
+	assert(ids[129] == 129);
+
+	ArlEntity e = arlecs_create_entity(world);
+	arlecs_add_component(world, e, ids[3]);
+	arlecs_add_component(world, e, ids[70]);
+	arlecs_add_component(world, e, ids[129]);
+
+	ArlComponentMask mask;
+	arlecs_entity_mask(world, e, &mask);
+	assert(arlecs_mask_test(&mask, 3));
+	assert(arlecs_mask_test(&mask, 70));
+	assert(arlecs_mask_test(&mask, 129));
+	assert(! arlecs_mask_test(&mask, 4));
+
+	// Parcours des bits
+	assert(arlecs_mask_next(&mask, 0) == 3);
+	assert(arlecs_mask_next(&mask, 4) == 70);
+	assert(arlecs_mask_next(&mask, 71) == 129);
+	assert(arlecs_mask_next(&mask, 130) == ARLECS_MAX_COMPONENT_TYPES);
+
+	ArlComponentMask query;
+	arlecs_mask_clear(&query);
+	arlecs_mask_set(&query, 70);
+	arlecs_mask_set(&query, 129);
+	assert(arlecs_mask_contains(&mask, &query));
+	assert(arlecs_has_components(world, e, &query));
+
+	arlecs_mask_set(&query, 128);
+	assert(! arlecs_mask_contains(&mask, &query));
+	assert(! arlecs_has_components(world, e, &query));
+	assert(arlecs_mask_intersects(&mask, &query));
+
+	arl_free(&arena);
+}
+
+ARMEL_TEST(test_world_stats) {
+	Armel arena, scratch;
+	arl_new(&arena, 4 * 1024 * 1024);
+	arl_new(&scratch, 64 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 10000);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	// 100 entités, dont 2 sans composant
+	for (int i = 0; i < 100; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		if (i < 98) arlecs_add_component(world, e, COMP_POS);
+		if (i % 10 == 0) arlecs_add_component(world, e, COMP_VEL);
+	}
+	arlecs_remove_component(world, 97, COMP_POS); // Dernier : pas de swap
+	arlecs_remove_component(world, 0, COMP_POS);  // Swap & pop
+
+	size_t used_before = arl_used(&arena);
+
+	ArlWorldStats stats;
+	arlecs_world_stats(world, &scratch, &stats);
+
+	assert(arl_used(&arena) == used_before); // Rien dans l'arène du monde
+	assert(arl_used(&scratch) == 0);         // Mémoire temporaire rendue
+	assert(stats.created_entities == 100);
+	assert(stats.peak_entity_id == 99);
+	assert(stats.live_counted && stats.live_entities == 97); // 0 a encore VEL, 97..99 n'ont plus rien
+	assert(stats.pool_count == 2);
+
+	ArlPoolStats* pos = &stats.pools[0];
+	assert(pos->component_id == COMP_POS);
+	assert(pos->count == 96);
+	assert(pos->capacity == 10000);
+	assert(pos->sparse_bytes == 10000 * sizeof(uint32_t));
+	assert(pos->data_bytes == 10000 * sizeof(Pos));
+	assert(pos->adds == 98 && pos->removes == 2 && pos->swaps == 1);
+	assert(pos->sparse_pages == 10);          // 10000 entrées / 1024 par page
+	assert(pos->pages_counted && pos->sparse_pages_used == 1); // Toutes les entités sont < 1024
+
+	assert(stats.pools[1].count == 10);
+	assert(stats.wasted_bytes == pos->wasted_bytes + stats.pools[1].wasted_bytes);
+
+	// Sans scratch (ni celle de frame) : le reste du rapport, les comptes temporaires inconnus
+	arlecs_world_stats(world, NULL, &stats);
+	assert(arl_used(&arena) == used_before);
+	assert(stats.live_entities == ARL_NULL_ID && stats.pools[0].sparse_pages_used == ARL_NULL_ID);
+	assert(! stats.live_counted && ! stats.pools[0].pages_counted);
+	assert(stats.pools[0].count == 96 && stats.pool_count == 2);
+
+	// L'affichage montre un tiret, jamais la sentinelle
+	char printed[1024] = { 0 };
+	FILE* capture = tmpfile();
+	assert(capture != NULL);
+	fflush(stdout);
+	int saved_stdout = dup(STDOUT_FILENO);
+	dup2(fileno(capture), STDOUT_FILENO);
+	arlecs_print_stats(&stats);
+	fflush(stdout);
+	dup2(saved_stdout, STDOUT_FILENO);
+	close(saved_stdout);
+	rewind(capture);
+	assert(fread(printed, 1, sizeof(printed) - 1, capture) > 0);
+	fclose(capture);
+	assert(strstr(printed, "- live / 100 created") != NULL && strstr(printed, "4294967295") == NULL);
+
+	// La scratch de frame sert par défaut
+	world->frame_scratch = &scratch;
+	arlecs_world_stats(world, NULL, &stats);
+	world->frame_scratch = NULL;
+	assert(stats.live_entities == 97 && arl_used(&scratch) == 0);
+
+	arl_free(&scratch);
+	arl_free(&arena);
+}
+
+ARMEL_TEST(test_snapshot_restore) {
+	Armel arena, saves;
+	arl_new(&arena, 1024 * 1024);
+	arl_new(&saves, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 100);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+	uint32_t comp_page = arlecs_register_component_aligned(world, 16, 4096);
+
+	for (int i = 0; i < 10; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+		if (i % 2) Vel_add(world, e, COMP_VEL)->vx = 1.0f;
+	}
+
+	arl_alloc(&saves, 1000); // Destination décalée par rapport à la source
+	ArlEcsWorld* snap = arlecs_world_clone_into(world, &saves);
+	assert(snap != world);
+	assert(arlecs_world_footprint(snap) == arlecs_world_footprint(world));
+
+	// Une pool plus alignée que ARLECS_SNAPSHOT_ALIGN le reste dans le clone
+	assert(world->max_align == 4096);
+	assert(((uintptr_t)snap->pools[comp_page]->data & 4095) == 0);
+
+	// Le clone est un monde autonome, qui ne partage rien avec l'original
+	assert(snap->pools[COMP_POS] != world->pools[COMP_POS]);
+	assert(Pos_get(snap, 7, COMP_POS)->x == 7.0f);
+	assert(Pos_get(snap, 7, COMP_POS) != Pos_get(world, 7, COMP_POS));
+
+	// La simulation continue : écritures, suppressions, nouvelles entités
+	Pos_get(world, 7, COMP_POS)->x = 700.0f;
+	arlecs_remove_component(world, 3, COMP_VEL);
+	ArlEntity late = arlecs_create_entity(world);
+	Vel_add(world, late, COMP_VEL);
+	assert(Pos_get(snap, 7, COMP_POS)->x == 7.0f);
+
+	// Rollback
+	ArlPool* pos_pool = world->pools[COMP_POS];
+	arlecs_world_restore(world, snap);
+
+	assert(world->pools[COMP_POS] == pos_pool); // Même adresse qu'avant
+	assert(world->arena == &arena);
+	assert(world->entity_counter == 10);
+	assert(Pos_get(world, 7, COMP_POS)->x == 7.0f);
+	assert(Vel_get(world, 3, COMP_VEL) != NULL);
+	assert(Vel_get(world, late, COMP_VEL) == NULL);
+
+	int count = 0;
+	ArlView view = arlecs_view(world, 2, COMP_VEL, COMP_POS);
+	while (arlecs_view_next(&view)) count++;
+	assert(count == 5);
+
+	arl_free(&saves);
+	arl_free(&arena);
+}
+
+ARMEL_TEST(test_world_delta) {
+	Armel arena, saves;
+	arl_new(&arena, 4 * 1024 * 1024);
+	arl_new(&saves, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 1000);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	for (int i = 0; i < 500; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+		if (i % 3 == 0) Vel_add(world, e, COMP_VEL)->vx = 1.0f;
+	}
+
+	ArlEcsWorld* before = arlecs_world_clone_into(world, &saves);
+	ArlEcsWorld* replica = arlecs_world_clone_into(world, &saves);
+
+	// Aucun changement : seulement l'en-tête
+	uint8_t buffer[16 * 1024];
+	ArlByteStream stream;
+	arlecs_stream_init(&stream, buffer, sizeof(buffer));
+	assert(arlecs_world_diff(before, world, &stream));
+	assert(stream.size == 3 * sizeof(uint32_t));
+
+	// Une modification, une suppression (swap), un ajout, une nouvelle entité
+	Pos_get(world, 250, COMP_POS)->x = -1.0f;
+	arlecs_remove_component(world, 3, COMP_VEL);
+	Vel_add(world, 4, COMP_VEL)->vx = 2.0f;
+	ArlEntity late = arlecs_create_entity(world);
+	Pos_add(world, late, COMP_POS)->y = 9.0f;
+
+	arlecs_stream_init(&stream, buffer, sizeof(buffer));
+	assert(arlecs_world_diff(before, world, &stream));
+	assert(stream.size < 256); // Compact : les blocs identiques sont ignorés
+
+	assert(arlecs_world_apply_delta(replica, stream.data, stream.size));
+
+	assert(replica->entity_counter == world->entity_counter);
+	assert(Pos_get(replica, 250, COMP_POS)->x == -1.0f);
+	assert(Vel_get(replica, 3, COMP_VEL) == NULL);
+	assert(Vel_get(replica, 4, COMP_VEL)->vx == 2.0f);
+	assert(Pos_get(replica, late, COMP_POS)->y == 9.0f);
+	assert(replica->pools[COMP_POS]->count == world->pools[COMP_POS]->count);
+	assert(replica->pools[COMP_VEL]->count == world->pools[COMP_VEL]->count);
+
+	// Plus aucune différence entre la réplique et l'original
+	arlecs_stream_init(&stream, buffer, sizeof(buffer));
+	arlecs_world_diff(replica, world, &stream);
+	assert(stream.size == 3 * sizeof(uint32_t));
+
+	// Un delta tronqué est refusé
+	arlecs_stream_init(&stream, buffer, sizeof(buffer));
+	arlecs_world_diff(before, world, &stream);
+	assert(! arlecs_world_apply_delta(before, stream.data, stream.size - 1));
+
+	// Entités hors du monde : refusées avant d'être tronquées en ArlEntity
+	arlecs_world_reserve_transients(replica, 100);
+	const uint32_t outside[4] = { 1000, 65536 + 10, 700, 950 }; // max_entities, au-delà, jamais créée, transitoire
+	for (int i = 0; i < 4; i++) {
+		uint32_t forged[10] = { ARLECS_DELTA_MAGIC, replica->entity_counter, 1, COMP_POS, sizeof(Pos), 0, 1, outside[i], 0, 0 };
+		assert(! arlecs_world_apply_delta(replica, forged, sizeof(forged)));
+		forged[5] = 1; forged[6] = 0; // Même entité, en suppression
+		assert(! arlecs_world_apply_delta(replica, forged, 8 * sizeof(uint32_t)));
+	}
+	assert(Pos_get(replica, 10, COMP_POS)->x == 10.0f);
+	assert(replica->pools[COMP_POS]->count == world->pools[COMP_POS]->count);
+
+	// Un compteur d'entités qui empiète sur la zone transitoire est refusé
+	uint32_t header[3] = { ARLECS_DELTA_MAGIC, 950, 0 };
+	assert(! arlecs_world_apply_delta(replica, header, sizeof(header)));
+	assert(replica->entity_counter == world->entity_counter);
+
+	arl_free(&saves);
+	arl_free(&arena);
+}
+
+static void shard_move_all(ArlEcsWorld* world, uint32_t shard, void* ctx) {
+	(void)ctx;
+	PosView v = PosView_begin(world, COMP_POS);
+	while (PosView_next(&v)) v.c0->y += (float)(shard + 1);
+}
+
+ARMEL_TEST(test_shards_migrate) {
+	Armel arenas[2];
+	arl_new(&arenas[0], 1024 * 1024);
+	arl_new(&arenas[1], 1024 * 1024);
+
+	ArlShardedWorld sw;
+	arlecs_shards_init(&sw, arenas, 2, 100);
+	COMP_POS    = arlecs_shards_component_new(&sw, Pos);
+	COMP_HEALTH = arlecs_shards_component_new(&sw, Health);
+	assert(sw.shards[0]->component_counter == 2 && sw.shards[1]->component_counter == 2);
+
+	ArlEcsWorld* west = sw.shards[0];
+	ArlEcsWorld* east = sw.shards[1];
+
+	ArlEntity a = arlecs_create_entity(west);
+	Pos_add(west, a, COMP_POS)->x = 5.0f;
+	((Health*)arlecs_add_component(west, a, COMP_HEALTH))->hp = 77;
+
+	ArlEntity b = arlecs_create_entity(east);
+	Pos_add(east, b, COMP_POS);
+
+	// L'entité passe d'ouest en est avec tous ses composants
+	ArlEntity moved = arlecs_migrate_entity(west, east, a);
+	assert(moved == 1);
+	assert(Pos_get(east, moved, COMP_POS)->x == 5.0f);
+	assert(((Health*)arlecs_get_component(east, moved, COMP_HEALTH))->hp == 77);
+	assert(west->pools[COMP_POS]->count == 0);
+	assert(west->pools[COMP_HEALTH]->count == 0);
+
+	// Sans threads : les shards tournent sur l'appelant
+	arlecs_shards_run(&sw, shard_move_all, NULL);
+	assert(Pos_get(east, moved, COMP_POS)->y == 2.0f);
+
+	// Un thread persistant par shard, réveillé à chaque appel
+	assert(arlecs_shards_start(&sw, NULL) >= 1);
+	for (int frame = 0; frame < 3; frame++) arlecs_shards_run(&sw, shard_move_all, NULL);
+	arlecs_shards_stop(&sw);
+	assert(Pos_get(east, moved, COMP_POS)->y == 8.0f);
+	assert(Pos_get(east, b, COMP_POS)->y == 8.0f);
+
+	// Descripteur : même ID et même stockage dans chaque shard
+	ArlPoolDesc rare = { sizeof(Vel), ARLECS_POOL_HASHED, 0.0f, 0, 1 };
+	uint32_t comp_rare = arlecs_shards_register_component_desc(&sw, &rare);
+	assert(west->pools[comp_rare]->hash && east->pools[comp_rare]->hash);
+	assert(east->pools[comp_rare]->dense_capacity == 1);
+
+	// Destination pleine : la migration échoue proprement, la source garde tout
+	ArlEntity c = arlecs_create_entity(west);
+	Pos_add(west, c, COMP_POS)->x = 9.0f;
+	arlecs_add_component(west, c, comp_rare);
+	arlecs_add_component(east, b, comp_rare);
+	assert(arlecs_migrate_entity(west, east, c) == ARL_NULL_ENTITY);
+	assert(Pos_get(west, c, COMP_POS)->x == 9.0f && arlecs_get_component(west, c, comp_rare));
+	assert(east->pools[COMP_POS]->count == 2 && east->entity_counter == 2);
+
+	arl_free(&arenas[1]);
+	arl_free(&arenas[0]);
+}
+
+#define SPAWN_THREADS 4
+#define SPAWN_PER_THREAD 2000
+
+static void* spawn_worker(void* arg) {
+	ArlEcsWorld* world = (ArlEcsWorld*)arg;
+
+	// Moitié par plage réservée, moitié une par une
+	ArlEntity first = arlecs_reserve_entities(world, SPAWN_PER_THREAD / 2);
+	for (uint32_t i = 0; i < SPAWN_PER_THREAD / 2; i++) {
+		Pos* p = arlecs_add_component_concurrent(world, first + i, COMP_POS);
+		p->x = (float)(first + i);
+	}
+	for (uint32_t i = 0; i < SPAWN_PER_THREAD / 2; i++) {
+		ArlEntity e = arlecs_create_entity_atomic(world);
+		Pos* p = arlecs_add_component_concurrent(world, e, COMP_POS);
+		p->x = (float)e;
+	}
+	return NULL;
+}
+
+ARMEL_TEST(test_concurrent_spawn) {
+	Armel arena;
+	arl_new(&arena, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, SPAWN_THREADS * SPAWN_PER_THREAD);
+	COMP_POS = arlecs_component_new(world, Pos);
+
+	pthread_t threads[SPAWN_THREADS];
+	for (int t = 0; t < SPAWN_THREADS; t++) pthread_create(&threads[t], NULL, spawn_worker, world);
+	for (int t = 0; t < SPAWN_THREADS; t++) pthread_join(threads[t], NULL);
+
+	ArlPool* pool = world->pools[COMP_POS];
+	assert(world->entity_counter == SPAWN_THREADS * SPAWN_PER_THREAD);
+	assert(pool->count == SPAWN_THREADS * SPAWN_PER_THREAD);
+	assert(pool->adds == SPAWN_THREADS * SPAWN_PER_THREAD);
+
+	// Chaque entité a été publiée une fois, avec ses propres données
+	for (ArlEntity e = 0; e < world->entity_counter; e++) {
+		Pos* p = Pos_get(world, e, COMP_POS);
+		assert(p != NULL && p->x == (float)e);
+	}
+
+	// Pool plein : refus propre, sans dépasser la capacité
+	assert(arlecs_pool_reserve_slots(pool, 1) == ARL_NULL_ID);
+	assert(pool->count == pool->capacity);
+
+	// Monde plein : même chose pour les IDs, le compteur ne bouge pas
+	assert(arlecs_reserve_entities(world, 1) == ARL_NULL_ENTITY);
+	assert(arlecs_create_entity_atomic(world) == ARL_NULL_ENTITY);
+	assert(world->entity_counter == SPAWN_THREADS * SPAWN_PER_THREAD);
+
+	arl_free(&arena);
+}
+
+// --- TESTS SYSTEMS ---
+
+static uintptr_t scratch_used_in_system = 0;
+
+static void sys_uses_scratch(ArlEcsWorld* world, void* ctx) {
+	(void)ctx;
+	Armel* scratch = arlecs_frame_scratch(world);
+	int* tmp = arl_array(scratch, int, 64);
+	tmp[63] = 42;
+
+	int* worker_tmp = arl_array(arlecs_worker_scratch(world, 1), int, 16);
+	worker_tmp[0] = 1;
+
+	scratch_used_in_system = arl_offset(scratch);
+}
+
+ARMEL_TEST(test_system_scratch) {
+	Armel arena, scratch_parent;
+	arl_new(&arena, 1024 * 1024);
+	arl_new(&scratch_parent, 64 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 10);
+
+	ArlSystemManager mgr;
+	arlecs_sys_init(&mgr);
+	arlecs_sys_init_scratch(&mgr, &scratch_parent, 4096, 2, 1024);
+	arlecs_sys_register(&mgr, "Scratch", ARL_PHASE_UPDATE, sys_uses_scratch);
+
+	size_t arena_used = arl_used(&arena);
+
+	for (int frame = 0; frame < 3; frame++) {
+		arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+
+		// The system did allocate, but everything is released after the phase
+		assert(scratch_used_in_system >= 64 * sizeof(int));
+		assert(arl_offset(&mgr.frame_scratch) == 0);
+		assert(arl_offset(&mgr.worker_scratch[1]) == 0);
+	}
+
+	// No leak in the permanent arena, and nothing bound outside of a phase
+	assert(arl_used(&arena) == arena_used);
+	assert(world->frame_scratch == NULL);
+
+	arl_free(&scratch_parent);
+	arl_free(&arena);
+}
+
+static int interval_runs = 0;
+static void sys_count_runs(ArlEcsWorld* world, void* ctx) {
+	(void)world; (void)ctx;
+	interval_runs++;
+}
+
+static void sys_sliced(ArlEcsWorld* world, void* ctx) {
+	uint32_t* visits = (uint32_t*)ctx;
+	ArlView view = arlecs_view(world, 1, COMP_POS);
+	while (arlecs_sys_slice_next(world, &view)) {
+		visits[view.entity]++;
+	}
+}
+
+ARMEL_TEST(test_system_interval_budget) {
+	Armel arena;
+	arl_new(&arena, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 100);
+	COMP_POS = arlecs_component_new(world, Pos);
+	for (int i = 0; i < 100; i++) arlecs_add_component(world, arlecs_create_entity(world), COMP_POS);
+
+	ArlSystemManager mgr;
+	arlecs_sys_init(&mgr);
+	arlecs_sys_register(&mgr, "AI", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "LOD", ARL_PHASE_RENDER, sys_sliced);
+
+	// 1 frame sur 6 (10 Hz à 60 FPS)
+	arlecs_sys_set_interval(&mgr, "AI", 6, 2);
+	interval_runs = 0;
+	for (int frame = 0; frame < 60; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	assert(interval_runs == 10);
+
+	// 30 entités par frame : un tour complet en 4 frames (30 + 30 + 30 + 10)
+	uint32_t visits[100] = {0};
+	arlecs_sys_set_budget(&mgr, "LOD", 30, 0);
+
+	for (int frame = 0; frame < 3; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_RENDER, visits);
+	assert(visits[0] == 1 && visits[89] == 1 && visits[90] == 0);
+
+	arlecs_sys_run_phase(&mgr, world, ARL_PHASE_RENDER, visits);
+	for (int i = 0; i < 100; i++) assert(visits[i] == 1);
+
+	arlecs_sys_run_phase(&mgr, world, ARL_PHASE_RENDER, visits); // Nouveau tour
+	assert(visits[0] == 2 && visits[29] == 2 && visits[30] == 1);
+	assert(world->slice == NULL);
+
+	// Hors système budgété : itération normale
+	ArlView view = arlecs_view(world, 1, COMP_POS);
+	int count = 0;
+	while (arlecs_sys_slice_next(world, &view)) count++;
+	assert(count == 100);
+
+	// Réactif et budgété : un tour interrompu reprend même si Pos ne change plus
+	uint32_t reactive_visits[100] = {0};
+	arlecs_sys_set_active(&mgr, "LOD", false);
+	arlecs_sys_register(&mgr, "LODR", ARL_PHASE_RENDER, sys_sliced);
+	arlecs_sys_require(&mgr, "LODR", COMP_POS);
+	arlecs_sys_set_reactive(&mgr, "LODR", true);
+	arlecs_sys_set_budget(&mgr, "LODR", 30, 0);
+
+	for (int frame = 0; frame < 6; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_RENDER, reactive_visits);
+	for (int i = 0; i < 100; i++) assert(reactive_visits[i] == 1); // 4 frames de tour, puis sauté
+	assert(arlecs_sys_find(&mgr, "LODR")->skips_unchanged == 2);
+
+	arl_free(&arena);
+}
+
+
+static int rebuild_runs = 0;
+static void sys_rebuild(ArlEcsWorld* world, void* ctx) {
+	(void)world; (void)ctx;
+	rebuild_runs++;
+}
+
+ARMEL_TEST(test_system_input_skips) {
+	Armel arena;
+	arl_new(&arena, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 100);
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+	for (int i = 0; i < 10; i++) arlecs_add_component(world, arlecs_create_entity(world), COMP_POS);
+
+	ArlSystemManager mgr;
+	arlecs_sys_init(&mgr);
+	arlecs_sys_register(&mgr, "Move", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "Collide", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "Rebuild", ARL_PHASE_UPDATE, sys_rebuild);
+
+	arlecs_sys_write(&mgr, "Move", COMP_POS);
+	arlecs_sys_set_active(&mgr, "Move", false);
+	arlecs_sys_require(&mgr, "Collide", COMP_VEL);
+	arlecs_sys_require(&mgr, "Rebuild", COMP_POS);
+	arlecs_sys_set_reactive(&mgr, "Rebuild", true);
+
+	// 1. Aucun Vel : Collide ne tourne jamais ; Pos inchangé : Rebuild une seule fois
+	interval_runs = rebuild_runs = 0;
+	for (int frame = 0; frame < 3; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	assert(interval_runs == 0 && rebuild_runs == 1);
+
+	ArlSystem* rebuild = arlecs_sys_find(&mgr, "Rebuild");
+	assert(arlecs_sys_find(&mgr, "Collide")->skips_empty == 3 && rebuild->skips_unchanged == 2);
+
+	// 2. Un ajout réveille Rebuild, un Vel réveille Collide
+	arlecs_add_component(world, arlecs_create_entity(world), COMP_POS);
+	arlecs_add_component(world, 0, COMP_VEL);
+	arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	assert(interval_runs == 2 && rebuild_runs == 2);
+
+	// 3. Écriture en place signalée à la main
+	arlecs_pool_touch(world->pools[COMP_POS]);
+	arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	assert(rebuild_runs == 3);
+
+	// 4. Un système qui déclare écrire Pos réveille Rebuild à chaque frame
+	arlecs_sys_set_active(&mgr, "Move", true);
+	for (int frame = 0; frame < 4; frame++) arlecs_sys_run_phase(&mgr, world, ARL_PHASE_UPDATE, NULL);
+	assert(rebuild_runs == 7 && world->pools[COMP_POS]->touches == 5);
+
+	ArlSystemStats stats;
+	arlecs_sys_stats(&mgr, &stats);
+	assert(stats.runs == 4 + 7 + 7 && stats.skips_empty == 3 && stats.skips_unchanged == 3);
+
+	// 5. Réplique : un delta qui ne fait que réécrire des Pos existants réveille Rebuild
+	Armel saves;
+	arl_new(&saves, 1024 * 1024);
+	ArlEcsWorld* before  = arlecs_world_clone_into(world, &saves);
+	ArlEcsWorld* replica = arlecs_world_clone_into(world, &saves);
+
+	ArlSystemManager client;
+	arlecs_sys_init(&client);
+	arlecs_sys_register(&client, "Rebuild", ARL_PHASE_UPDATE, sys_rebuild);
+	arlecs_sys_require(&client, "Rebuild", COMP_POS);
+	arlecs_sys_set_reactive(&client, "Rebuild", true);
+
+	rebuild_runs = 0;
+	arlecs_sys_run_phase(&client, replica, ARL_PHASE_UPDATE, NULL);
+	arlecs_sys_run_phase(&client, replica, ARL_PHASE_UPDATE, NULL);
+	assert(rebuild_runs == 1);
+
+	Pos_get(world, 2, COMP_POS)->x = 5.0f;
+	uint8_t buffer[1024];
+	ArlByteStream stream;
+	arlecs_stream_init(&stream, buffer, sizeof(buffer));
+	assert(arlecs_world_diff(before, world, &stream));
+	assert(arlecs_world_apply_delta(replica, stream.data, stream.size));
+	assert(replica->pools[COMP_POS]->count == before->pools[COMP_POS]->count); // Aucun ajout
+
+	arlecs_sys_run_phase(&client, replica, ARL_PHASE_UPDATE, NULL);
+	assert(rebuild_runs == 2 && Pos_get(replica, 2, COMP_POS)->x == 5.0f);
+
+	arl_free(&saves);
+	arl_free(&arena);
+}
+
+
+// --- TESTS RESOURCES ---
+
+typedef struct { double time; uint32_t frame; } Clock;
+typedef struct { float gravity; } PhysicsConfig;
+
+ARMEL_TEST(test_world_resources) {
+	Armel arena;
+	arl_new(&arena, 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 10);
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	uint32_t RES_CLOCK = arlecs_resource_new(world, Clock);
+	uint32_t RES_PHYS = arlecs_resource_new(world, PhysicsConfig);
+
+	// Une seule instance, initialisée à zéro, toujours à la même adresse
+	Clock* clock = arlecs_resource_get(world, RES_CLOCK, Clock);
+	assert(clock->frame == 0 && clock->time == 0.0);
+	clock->frame = 7;
+	assert(arlecs_resource_get(world, RES_CLOCK, Clock)->frame == 7);
+	arlecs_resource_get(world, RES_PHYS, PhysicsConfig)->gravity = -9.81f;
+
+	// Les ressources suivent le monde dans les snapshots
+	Armel snap_arena;
+	arl_new(&snap_arena, 1024 * 1024);
+	ArlEcsWorld* snap = arlecs_world_clone_into(world, &snap_arena);
+	clock->frame = 99;
+	assert(arlecs_resource_get(snap, RES_CLOCK, Clock)->frame == 7);
+	arlecs_world_restore(world, snap);
+	assert(arlecs_resource_get(world, RES_CLOCK, Clock)->frame == 7);
+	assert(arlecs_resource_get(world, RES_PHYS, PhysicsConfig)->gravity == -9.81f);
+
+	// Déclarations d'accès
+	ArlSystemManager mgr;
+	arlecs_sys_init(&mgr);
+	arlecs_sys_register(&mgr, "Physics", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "Render", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "Tick", ARL_PHASE_UPDATE, sys_count_runs);
+	arlecs_sys_register(&mgr, "Legacy", ARL_PHASE_UPDATE, sys_count_runs);
+
+	arlecs_sys_write(&mgr, "Physics", COMP_POS);
+	arlecs_sys_read(&mgr, "Physics", COMP_VEL);
+	arlecs_sys_read_resource(&mgr, "Physics", RES_CLOCK);
+	arlecs_sys_read_resource(&mgr, "Physics", RES_PHYS);
+
+	arlecs_sys_read(&mgr, "Render", COMP_VEL);
+	arlecs_sys_read_resource(&mgr, "Render", RES_CLOCK);
+
+	arlecs_sys_write_resource(&mgr, "Tick", RES_CLOCK);
+
+	ArlSystem* physics = arlecs_sys_find(&mgr, "Physics");
+	ArlSystem* render = arlecs_sys_find(&mgr, "Render");
+	ArlSystem* tick = arlecs_sys_find(&mgr, "Tick");
+	ArlSystem* legacy = arlecs_sys_find(&mgr, "Legacy");
+
+	assert(! arlecs_sys_conflicts(physics, render)); // Lectures partagées
+	assert(arlecs_sys_conflicts(physics, tick));     // Écrit l'horloge lue par la physique
+	assert(arlecs_sys_conflicts(render, tick));
+	assert(arlecs_sys_conflicts(legacy, render));    // Accès inconnus
+
+	arl_free(&snap_arena);
+	arl_free(&arena);
+}
+
+
+// --- TESTS STABLE POOLS ---
+
+typedef struct { uint32_t id; uint8_t payload[300]; } Mesh;
+
+ARMEL_TEST(test_stable_pool) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 1000);
+
+	ArlPoolDesc desc = { sizeof(Mesh), ARLECS_POOL_STABLE, 0.0f, 0, 0 };
+	uint32_t COMP_MESH = arlecs_register_component_desc(world, &desc);
+	COMP_POS = arlecs_component_new(world, Pos);
+	ArlPool* pool = world->pools[COMP_MESH];
+
+	for (uint32_t i = 0; i < 200; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		((Mesh*)arlecs_add_component(world, e, COMP_MESH))->id = i;
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+	}
+
+	// Les suppressions ne déplacent rien : les pointeurs restent valides
+	Mesh* kept = (Mesh*)arlecs_get_component(world, 150, COMP_MESH);
+	for (ArlEntity e = 0; e < 100; e += 2) arlecs_remove_component(world, e, COMP_MESH);
+
+	assert(kept == arlecs_get_component(world, 150, COMP_MESH) && kept->id == 150);
+	assert(pool->count == 200 && pool->tombstones == 50 && pool->swaps == 0);
+	assert(arlecs_pool_size(pool) == 150);
+	assert(arlecs_get_component(world, 10, COMP_MESH) == NULL);
+
+	// Les vues sautent les tombes
+	uint32_t seen = 0;
+	ArlView view = arlecs_view(world, 2, COMP_MESH, COMP_POS);
+	while (arlecs_view_next(&view)) {
+		assert(view.entity >= 100 || view.entity % 2 == 1);
+		assert(((Mesh*)view.components[0])->id == view.entity);
+		seen++;
+	}
+	assert(seen == 150);
+
+	// Un ajout réutilise un slot mort
+	ArlEntity fresh = arlecs_create_entity(world);
+	((Mesh*)arlecs_add_component(world, fresh, COMP_MESH))->id = fresh;
+	assert(pool->count == 200 && pool->tombstones == 49);
+
+	// Compaction différée : 49 / 200 reste sous le seuil, 60 / 200 le dépasse
+	assert(arlecs_world_compact(world) == 0);
+	for (ArlEntity e = 101; e < 123; e += 2) arlecs_remove_component(world, e, COMP_MESH);
+	assert(arlecs_world_compact(world) == 1);
+	assert(pool->tombstones == 0 && pool->count == 140);
+
+	// Ordre conservé, liens à jour
+	uint32_t last_id = 0;
+	for (uint32_t i = 0; i < pool->count; i++) {
+		Mesh* m = (Mesh*)(pool->data + i * pool->elem_size);
+		assert(m->id == pool->dense[i] && arlecs_pool_index(pool, pool->dense[i]) == i);
+		if (pool->dense[i] != fresh) { assert(m->id >= last_id); last_id = m->id; }
+	}
+
+	arl_free(&arena);
+}
+
+
+static bool pos_expired(ArlEntity entity, void* data, void* ctx) {
+	(void)entity;
+	return ((Pos*)data)->x < *(float*)ctx;
+}
+
+ARMEL_TEST(test_bulk_removal) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 1000);
+
+	ArlPoolDesc desc = { sizeof(Pos), ARLECS_POOL_BITSET, 0.0f, 0, 0 };
+	COMP_POS = arlecs_register_component_desc(world, &desc);
+	ArlPoolDesc stable = { sizeof(Mesh), ARLECS_POOL_STABLE, 0.0f, 0, 0 };
+	uint32_t COMP_MESH = arlecs_register_component_desc(world, &stable);
+
+	for (uint32_t i = 0; i < 500; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)(i % 10);
+		((Mesh*)arlecs_add_component(world, e, COMP_MESH))->id = i;
+	}
+
+	// 1. Prédicat : 30% des éléments partent, les survivants gardent leur ordre
+	ArlPool* pool = world->pools[COMP_POS];
+	float threshold = 3.0f;
+	assert(arlecs_pool_remove_if(pool, pos_expired, &threshold) == 150);
+	assert(pool->count == 350 && pool->removes == 150);
+
+	for (uint32_t i = 0; i < pool->count; i++) {
+		assert(arlecs_pool_index(pool, pool->dense[i]) == i);
+		assert(((Pos*)pool->data)[i].x >= 3.0f);
+		if (i) assert(pool->dense[i] > pool->dense[i - 1]);
+	}
+	assert(Pos_get(world, 10, COMP_POS) == NULL && ! (pool->bits[0] & ((uint64_t)1 << 10)));
+	assert(Pos_get(world, 13, COMP_POS)->x == 3.0f);
+
+	// 2. Liste d'entités sur un pool stable troué : doublons et absents ignorés
+	ArlPool* meshes = world->pools[COMP_MESH];
+	arlecs_remove_component(world, 5, COMP_MESH); // Une tombe avant le premier retrait
+	assert(meshes->tombstones == 1);
+
+	ArlEntity doomed[] = { 100, 200, 200, 5, 999, 300 };
+	assert(arlecs_remove_components_batch(world, COMP_MESH, doomed, 6) == 3);
+	assert(meshes->count == 496 && meshes->tombstones == 0 && meshes->free_head == ARL_NULL_ID);
+
+	uint32_t last_id = 0;
+	for (uint32_t i = 0; i < meshes->count; i++) {
+		Mesh* m = (Mesh*)(meshes->data + i * meshes->elem_size);
+		assert(m->id == meshes->dense[i] && arlecs_pool_index(meshes, meshes->dense[i]) == i);
+		assert(i == 0 || m->id > last_id);
+		last_id = m->id;
+	}
+	assert(arlecs_get_component(world, 200, COMP_MESH) == NULL);
+
+	// Le pool reste utilisable après compactage
+	((Mesh*)arlecs_add_component(world, 200, COMP_MESH))->id = 200;
+	assert(meshes->count == 497 && meshes->dense[496] == 200);
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS BITSETS ---
+
+ARMEL_TEST(test_bitset_view) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 20000);
+
+	ArlPoolDesc desc = { sizeof(Pos), ARLECS_POOL_BITSET, 0.0f, 0, 0 };
+	COMP_POS = arlecs_register_component_desc(world, &desc);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	// Pos : 1 entité sur 10, Vel : 1 sur 2, région [8192, 16384) vide
+	for (ArlEntity e = 0; e < 20000; e++) {
+		arlecs_create_entity(world);
+		if (e >= 8192 && e < 16384) continue;
+		if (e % 10 == 0) Pos_add(world, e, COMP_POS)->x = (float)e;
+		if (e % 2 == 0) arlecs_add_component(world, e, COMP_VEL);
+	}
+
+	// Bitset ajouté après coup, rempli depuis le dense
+	arlecs_pool_enable_bitset(world->pools[COMP_VEL], &arena);
+	arlecs_remove_component(world, 20, COMP_VEL);
+
+	uint32_t count = 0;
+	ArlEntity previous = 0;
+	ArlBitsetView view = arlecs_bitset_view(world, 2, COMP_POS, COMP_VEL);
+	while (arlecs_bitset_view_next(&view)) {
+		assert(view.entity % 10 == 0 && view.entity != 20);
+		assert(count == 0 || view.entity > previous); // Ordre des IDs
+		assert(((Pos*)view.components[0])->x == (float)view.entity);
+		assert(view.components[1] == arlecs_get_component(world, view.entity, COMP_VEL));
+		previous = view.entity;
+		count++;
+
+		// Retirer l'entité suivante du même mot pendant l'itération
+		if (view.entity == 100) arlecs_remove_component(world, 110, COMP_POS);
+	}
+
+	// Même résultat que la vue classique
+	uint32_t expected = 0;
+	ArlView classic = arlecs_view(world, 2, COMP_POS, COMP_VEL);
+	while (arlecs_view_next(&classic)) expected++;
+	assert(count == expected && count == 1181 - 2);
+
+	// Le bitset suit les suppressions : mot vide -> bit du niveau haut effacé
+	ArlPool* pool = world->pools[COMP_POS];
+	for (ArlEntity e = 0; e < 64; e += 10) arlecs_remove_component(world, e, COMP_POS);
+	assert(pool->bits[0] == 0 && (pool->bits_top[0] & 1) == 0);
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS INDEX 16 BITS ---
 
+// Plus d'entités que d'index 16 bits, sauf si les entités elles-mêmes sont sur 16 bits
+#ifdef ARLECS_COMPACT_ENTITY
+	#define INDEX16_WORLD 60000u
+#else
+	#define INDEX16_WORLD 100000u
+#endif
+
+ARMEL_TEST(test_index16_pool) {
+	Armel arena;
+	arl_new(&arena, 8 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, INDEX16_WORLD);
+
+	ArlPoolDesc desc = { sizeof(Vel), ARLECS_POOL_INDEX16, 0.0f, 0, 0 };
+	COMP_VEL = arlecs_register_component_desc(world, &desc);
+	COMP_POS = arlecs_component_new(world, Pos);
+	ArlPool* vel = world->pools[COMP_VEL];
+
+	// Sparse deux fois plus petit, dense limité à 65535 composants
+	assert(vel->sparse_shift == 1 && vel->dense_capacity == (INDEX16_WORLD < ARLECS_INDEX16_MAX ? INDEX16_WORLD : ARLECS_INDEX16_MAX));
+
+	arlecs_reserve_entities(world, INDEX16_WORLD);
+	for (uint32_t i = 0; i < INDEX16_WORLD; i += 100) {
+		ArlEntity e = (ArlEntity)i;
+		Pos_add(world, e, COMP_POS)->x = (float)e;
+		Vel_add(world, e % 200 == 0 ? e : e + 1, COMP_VEL)->vx = 1.0f;
+	}
+
+	// Dernière entité du monde : la lecture de 4 octets reste dans le tableau
+	Vel_add(world, INDEX16_WORLD - 1, COMP_VEL)->vx = 2.0f;
+	assert(Vel_get(world, INDEX16_WORLD - 1, COMP_VEL)->vx == 2.0f);
+	assert(Vel_get(world, INDEX16_WORLD - 2, COMP_VEL) == NULL);
+
+	// Vue mixte 16 / 32 bits, dans les deux sens
+	uint32_t a = 0, b = 0;
+	ArlView v1 = arlecs_view(world, 2, COMP_POS, COMP_VEL);
+	while (arlecs_view_next(&v1)) { assert(v1.entity % 200 == 0); a++; }
+	ArlView v2 = arlecs_view(world, 2, COMP_VEL, COMP_POS);
+	while (arlecs_view_next(&v2)) { assert(((Pos*)v2.components[1])->x == (float)v2.entity); b++; }
+	assert(a == INDEX16_WORLD / 200 && b == INDEX16_WORLD / 200);
+
+	// Swap & pop : l'index 16 bits du dernier élément est mis à jour
+	arlecs_remove_component(world, 0, COMP_VEL);
+	assert(Vel_get(world, 0, COMP_VEL) == NULL && Vel_get(world, INDEX16_WORLD - 1, COMP_VEL)->vx == 2.0f);
+
+	ArlWorldStats stats;
+	arlecs_world_stats(world, NULL, &stats);
+	assert(stats.pools[COMP_VEL].index_bits == 16 && stats.pools[COMP_VEL].sparse_bytes == INDEX16_WORLD * 2);
+	assert(stats.pools[COMP_POS].index_bits == 32 && stats.pools[COMP_POS].sparse_bytes == INDEX16_WORLD * 4);
+
+	arl_free(&arena);
+}
+
+
+ARMEL_TEST(test_aligned_pool) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 1000);
+
+	typedef struct { _Alignas(32) float v[8]; } Lanes;
+	typedef struct { float x, y, z; } Float3;
+
+	// 1. Tout pool a sa data alignée sur une ligne de cache
+	COMP_POS = arlecs_component_new(world, Pos);
+	assert(((uintptr_t)world->pools[COMP_POS]->data & (ARLECS_POOL_DATA_ALIGN - 1)) == 0);
+	assert(world->pools[COMP_POS]->elem_size == sizeof(Pos));
+
+	// 2. Alignement du type plus grand : data alignée, stride inchangé (sizeof déjà multiple)
+	uint32_t COMP_LANES = arlecs_component_new_aligned(world, Lanes);
+	ArlPool* lanes = world->pools[COMP_LANES];
+	assert(lanes->align == 64 && lanes->elem_size == 32);
+
+	// 3. Stride rembourré : un float3 de 12 octets rangé tous les 16 octets
+	uint32_t COMP_F3 = arlecs_register_component_aligned(world, sizeof(Float3), 16);
+	ArlPool* f3 = world->pools[COMP_F3];
+	assert(f3->type_size == 12 && f3->elem_size == 16);
+
+	for (int i = 0; i < 100; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Float3* p = (Float3*)arlecs_add_component(world, e, COMP_F3);
+		assert(((uintptr_t)p & 15) == 0);
+		p->x = (float)e;
+	}
+	arlecs_remove_component(world, 10, COMP_F3); // Swap & pop avec le stride rembourré
+	assert(((Float3*)arlecs_get_component(world, 99, COMP_F3))->x == 99.0f);
+
+	uint32_t count = 0;
+	ArlView view = arlecs_view(world, 1, COMP_F3);
+	while (arlecs_view_next(&view)) {
+		assert(((uintptr_t)view.components[0] & 15) == 0);
+		assert(((Float3*)view.components[0])->x == (float)view.entity);
+		count++;
+	}
+	assert(count == 99);
+
+	arl_free(&arena);
+}
+
+
+ARMEL_TEST(test_hashed_pool) {
+	Armel arena;
+	arl_new(&arena, 16 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 60000);
+	arlecs_world_reserve_transients(world, 1000);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new_hashed(world, Vel, 8);
+	ArlPool* vel = world->pools[COMP_VEL];
+	assert(vel->sparse == NULL && vel->hash_mask == 15 && vel->dense_capacity == 8);
+	assert(vel->sparse_limit == 0 && world->pools[COMP_POS]->sparse_limit == 60000);
+
+	for (int i = 0; i < 60000 - 1000; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		if (e % 10 == 0) Pos_add(world, e, COMP_POS)->x = (float)e;
+	}
+
+	// 1. Quelques porteurs dispersés, accès direct
+	ArlEntity holders[8] = { 0, 7, 50, 12345, 12355, 40000, 58990, 58999 };
+	for (int i = 0; i < 8; i++) Vel_add(world, holders[i], COMP_VEL)->vx = (float)holders[i];
+	assert(arlecs_pool_size(vel) == 8);
+	for (int i = 0; i < 8; i++) assert(Vel_get(world, holders[i], COMP_VEL)->vx == (float)holders[i]);
+	assert(Vel_get(world, 8, COMP_VEL) == NULL && Vel_get(world, 59999, COMP_VEL) == NULL);
+
+	// 2. Vues dans les deux sens : le pool haché comme maître ou comme sonde
+	uint32_t a = 0, b = 0;
+	ArlView v1 = arlecs_view(world, 2, COMP_VEL, COMP_POS);
+	while (arlecs_view_next(&v1)) { assert(((Pos*)v1.components[1])->x == (float)v1.entity); a++; }
+	ArlView v2 = arlecs_view(world, 2, COMP_POS, COMP_VEL);
+	while (arlecs_view_next(&v2)) { assert(((Vel*)v2.components[1])->vx == (float)v2.entity); b++; }
+	assert(a == 4 && b == 4); // 0, 50, 40000, 58990
+
+	// 3. Retraits puis réinsertions : les chaînes de sondage restent intactes
+	arlecs_remove_component(world, 7, COMP_VEL);
+	arlecs_remove_component(world, 12345, COMP_VEL);
+	assert(Vel_get(world, 7, COMP_VEL) == NULL && Vel_get(world, 12345, COMP_VEL) == NULL);
+	for (int i = 0; i < 8; i++) {
+		if (holders[i] != 7 && holders[i] != 12345) assert(Vel_get(world, holders[i], COMP_VEL)->vx == (float)holders[i]);
+	}
+	Vel_add(world, 42, COMP_VEL)->vx = 42.0f;
+	assert(Vel_get(world, 42, COMP_VEL)->vx == 42.0f && arlecs_pool_size(vel) == 7);
+
+	// 4. Composants transitoires : leurs entrées disparaissent avec eux
+	ArlEntity t = arlecs_create_transient(world);
+	Vel_add(world, t, COMP_VEL)->vx = -1.0f;
+	assert(Vel_get(world, t, COMP_VEL)->vx == -1.0f);
+	arlecs_expire_transients(world);
+	assert(Vel_get(world, t, COMP_VEL) == NULL && arlecs_pool_size(vel) == 7);
+	assert(Vel_get(world, 42, COMP_VEL)->vx == 42.0f);
+
+	// 5. Table pleine de collisions : ajouts / retraits aléatoires contre une référence
+	uint32_t COMP_RARE = arlecs_register_component_hashed(world, sizeof(uint32_t), 0);
+	ArlPool* rare = world->pools[COMP_RARE];
+	assert(rare->dense_capacity == ARLECS_POOL_HASH_CAPACITY);
+
+	static bool has[4096];
+	memset(has, 0, sizeof(has));
+	uint32_t seed = 12345;
+	for (int step = 0; step < 20000; step++) {
+		seed = seed * 1664525u + 1013904223u;
+		ArlEntity e = (seed >> 8) % 1500;
+		if (has[e]) {
+			arlecs_remove_component(world, e, COMP_RARE);
+			has[e] = false;
+		} else if (arlecs_pool_size(rare) < ARLECS_POOL_HASH_CAPACITY) {
+			*(uint32_t*)arlecs_add_component(world, e, COMP_RARE) = e;
+			has[e] = true;
+		}
+	}
+	for (ArlEntity e = 0; e < 1500; e++) {
+		uint32_t* value = (uint32_t*)arlecs_get_component(world, e, COMP_RARE);
+		assert(has[e] ? value && *value == e : value == NULL);
+	}
+
+	// 6. Mémoire : la table remplace un sparse de max_entities entrées
+	ArlWorldStats stats;
+	arlecs_world_stats(world, NULL, &stats);
+	assert(stats.pools[COMP_VEL].sparse_bytes == 16 * sizeof(ArlHashSlot));
+	assert(stats.pools[COMP_VEL].data_bytes == 8 * sizeof(Vel));
+	assert(stats.pools[COMP_POS].sparse_bytes == 60000 * 4);
+
+	arlecs_pool_clear(vel);
+	assert(Vel_get(world, 0, COMP_VEL) == NULL);
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS MEMOIRE ---
+
+ARMEL_TEST(test_memory_hints) {
+	const uint32_t requested = ARLECS_MEM_HUGEPAGES | ARLECS_MEM_NUMA;
+
+	// 1. Les indications sont retenues par le monde et transmises aux pools
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create_ex(&arena, 10000, requested, 0);
+	assert(world->mem_flags == requested && world->numa_node == 0);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	ArlPool* pool = world->pools[COMP_POS];
+	assert((pool->mem_flags & ~requested) == 0); // Best effort : jamais plus que demandé
+
+	// 2. Les composants se comportent comme sans indication
+	for (uint32_t i = 0; i < 1000; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+	}
+	arlecs_remove_component(world, 10, COMP_POS);
+	assert(Pos_get(world, 999, COMP_POS)->x == 999.0f);
+	assert(Pos_get(world, 10, COMP_POS) == NULL);
+
+	uint32_t count = 0;
+	ArlView view = arlecs_view(world, 1, COMP_POS);
+	while (arlecs_view_next(&view)) {
+		assert(((Pos*)view.components[0])->x == (float)view.entity);
+		count++;
+	}
+	assert(count == 999);
+
+	// 3. arlecs_mem_advise ne rend qu'un sous-ensemble des indications demandées
+	assert(arlecs_mem_advise(arena.base, arena.capacity, ARLECS_MEM_DEFAULT, -1) == ARLECS_MEM_DEFAULT);
+	assert((arlecs_mem_advise(arena.base, arena.capacity, requested, 0) & ~requested) == 0);
+	assert(arlecs_mem_advise(arena.base, 16, requested, 0) == ARLECS_MEM_DEFAULT); // Aucune page entière
+	assert((arlecs_mem_advise(arena.base, arena.capacity, ARLECS_MEM_NUMA, -1) & ARLECS_MEM_NUMA) == 0); // Noeud invalide
+	arl_free(&arena);
+
+	// 4. Arène huge pages : MAP_HUGETLB si des pages sont réservées, sinon repli sur une arène classique
+	Armel huge;
+	const size_t size = 1024 * 1024;
+	uint32_t done = arlecs_arena_new_huge(&huge, size, ARLECS_MEM_HUGEPAGES, -1);
+	assert(huge.base != NULL && huge.capacity >= size);
+	if (done & ARLECS_MEM_HUGETLB) {
+		assert(((uintptr_t)huge.base & (ARLECS_HUGE_PAGE_SIZE - 1)) == 0);
+		assert(huge.capacity % ARLECS_HUGE_PAGE_SIZE == 0);
+		assert(done & ARLECS_MEM_HUGEPAGES);
+	} else {
+		assert((done & ~ARLECS_MEM_HUGEPAGES) == 0); // Repli : seule l'indication THP peut être acceptée
+	}
+
+	// Dans les deux cas l'arène sert un monde comme une autre
+	world = arlecs_world_create(&huge, 1000);
+	COMP_POS = arlecs_component_new(world, Pos);
+	for (uint32_t i = 0; i < 100; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->y = (float)i;
+	}
+	assert(Pos_get(world, 42, COMP_POS)->y == 42.0f);
+	arl_free(&huge);
+
+	// 5. Shards : chaque monde reçoit les indications et le noeud de son thread
+	Armel arenas[2];
+	arl_new(&arenas[0], 1024 * 1024);
+	arl_new(&arenas[1], 1024 * 1024);
+	const int nodes[2] = { 0, 1 };
+	ArlShardedWorld sw;
+	arlecs_shards_init_ex(&sw, arenas, 2, 1000, requested, nodes);
+	COMP_POS = arlecs_shards_component_new(&sw, Pos);
+	for (uint32_t i = 0; i < 2; i++) {
+		assert(sw.shards[i]->mem_flags == requested && sw.shards[i]->numa_node == nodes[i]);
+		assert((sw.shards[i]->pools[COMP_POS]->mem_flags & ~requested) == 0);
+	}
+
+	arlecs_shards_init(&sw, arenas, 2, 1000); // Sans indication, comme avant
+	assert(sw.shards[1]->mem_flags == ARLECS_MEM_DEFAULT && sw.shards[1]->numa_node == -1);
+	arl_free(&arenas[0]);
+	arl_free(&arenas[1]);
+}
+
+
+// --- TESTS PREFETCH ---
+
+// Parcourt la vue et range chaque entité suivie de ses pointeurs de composants
+static uint32_t view_trace(ArlEcsWorld* world, uint32_t distance, uintptr_t* out, uint32_t pools_count, uint32_t* ids) {
+	ArlView view = arlecs_view(world, pools_count, ids[0], ids[1], ids[2], ids[3]);
+	arlecs_view_set_prefetch(&view, distance);
+
+	uint32_t n = 0;
+	while (arlecs_view_next(&view)) {
+		out[n++] = view.entity;
+		for (uint32_t i = 0; i < pools_count; i++) out[n++] = (uintptr_t)view.components[i];
+	}
+	return n;
+}
+
+ARMEL_TEST(test_view_prefetch) {
+	Armel arena;
+	arl_new(&arena, 16 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, INDEX16_WORLD);
+
+	// Maître stable avec des tombes, secondaires dense, haché et index 16 bits
+	const uint32_t total = 2000;
+	ArlPoolDesc stable = { sizeof(Mesh), ARLECS_POOL_STABLE, 0.0f, 0, total };
+	ArlPoolDesc narrow = { sizeof(Vel), ARLECS_POOL_INDEX16, 0.0f, 0, 0 };
+	uint32_t COMP_MESH = arlecs_register_component_desc(world, &stable);
+	COMP_POS = arlecs_component_new(world, Pos);
+	uint32_t COMP_RARE = arlecs_component_new_hashed(world, Health, 64);
+	uint32_t COMP_NARROW = arlecs_register_component_desc(world, &narrow);
+
+	for (uint32_t i = 0; i < total; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		((Mesh*)arlecs_add_component(world, e, COMP_MESH))->id = e;
+		if (e % 5) Pos_add(world, e, COMP_POS)->x = (float)e;
+		if (e % 40 == 1 || e >= total - 8) ((Health*)arlecs_add_component(world, e, COMP_RARE))->hp = (int)e;
+		if (e % 2) ((Vel*)arlecs_add_component(world, e, COMP_NARROW))->vx = (float)e;
+	}
+	for (ArlEntity e = 0; e < total; e += 3) arlecs_remove_component(world, e, COMP_MESH);
+	arlecs_remove_component(world, total - 2, COMP_MESH); // Tombe près de la fin du dense
+	assert(world->pools[COMP_MESH]->tombstones > 0);
+
+	// Les distances couvrent 1, une valeur usuelle, et plus loin que la fin du tableau
+	const uint32_t distances[] = { 1, 4, 16, 3 * total };
+	const uint32_t widths[] = { 2, 3, 4 };
+	uint32_t ids[4] = { COMP_MESH, COMP_POS, COMP_RARE, COMP_NARROW };
+	uintptr_t* expected = (uintptr_t*)arl_alloc(&arena, (size_t)total * 5 * sizeof(uintptr_t));
+	uintptr_t* traced = (uintptr_t*)arl_alloc(&arena, (size_t)total * 5 * sizeof(uintptr_t));
+
+	for (uint32_t w = 0; w < 3; w++) {
+		uint32_t n = view_trace(world, 0, expected, widths[w], ids);
+		assert(n > 0);
+		for (uint32_t d = 0; d < 4; d++) {
+			assert(view_trace(world, distances[d], traced, widths[w], ids) == n);
+			assert(memcmp(expected, traced, n * sizeof(uintptr_t)) == 0);
+		}
+	}
+
+	// Le haché filtre : ses derniers porteurs sont vus, aussi après les tombes de fin
+	uint32_t n = view_trace(world, 16, traced, 3, ids);
+	assert(traced[n - 4] == total - 1 && ((Health*)traced[n - 1])->hp == (int)(total - 1));
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS PERSISTENCE ---
+
+ARMEL_TEST(test_persistent_world) {
+	char path[] = "/tmp/arlecs_persist_XXXXXX";
+	int fd = mkstemp(path);
+	assert(fd >= 0);
+	close(fd);
+
+	// 1. Premier processus : crée le monde dans le fichier
+	ArlPersistentArena pa;
+	assert(arlecs_persist_open(&pa, path, 1024 * 1024));
+	assert(pa.world == NULL);
+
+	ArlEcsWorld* world = arlecs_persist_world(&pa, 1000);
+	COMP_POS = arlecs_component_new(world, Pos);
+	uint32_t RES_TICK = arlecs_resource_new(world, uint32_t);
+	arlecs_persist_checkpoint(&pa, false);
+
+	for (int i = 0; i < 100; i++) {
+		Pos_add(world, arlecs_create_entity(world), COMP_POS)->x = (float)i;
+	}
+	*arlecs_resource_get(world, RES_TICK, uint32_t) = 42;
+
+	void* old_base = pa.header;
+	arlecs_persist_close(&pa);
+
+	// 2. Redémarrage : l'ancienne adresse est occupée, le monde doit être recalé
+	void* squatter = mmap(old_base, 1024 * 1024, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	assert(squatter != MAP_FAILED);
+
+	assert(arlecs_persist_open(&pa, path, 0));
+	assert(pa.world != NULL);
+	if (squatter == old_base) assert(pa.relocated);
+	world = pa.world;
+
+	assert(world->entity_counter == 100 && world->arena == &pa.arena);
+	for (ArlEntity e = 0; e < 100; e++) assert(Pos_get(world, e, COMP_POS)->x == (float)e);
+	assert(*arlecs_resource_get(world, RES_TICK, uint32_t) == 42);
+
+	// Le monde reste vivant : ajouts et vues fonctionnent après recalage
+	Pos_add(world, arlecs_create_entity(world), COMP_POS)->x = 100.0f;
+	uint32_t count = 0;
+	ArlView view = arlecs_view(world, 1, COMP_POS);
+	while (arlecs_view_next(&view)) count++;
+	assert(count == 101);
+
+	arlecs_persist_close(&pa);
+	munmap(squatter, 1024 * 1024);
+	unlink(path);
+
+	// 3. Fichier existant qui n'est pas un monde : refusé, contenu intact
+	char other[] = "/tmp/arlecs_other_XXXXXX";
+	fd = mkstemp(other);
+	assert(fd >= 0);
+	static uint8_t user_data[8192];
+	for (size_t i = 0; i < sizeof(user_data); i++) user_data[i] = (uint8_t)(i * 7);
+	assert(write(fd, user_data, sizeof(user_data)) == (ssize_t)sizeof(user_data));
+
+	assert(! arlecs_persist_open(&pa, other, 1024 * 1024));
+
+	static uint8_t read_back[8192];
+	struct stat st;
+	assert(fstat(fd, &st) == 0 && st.st_size == (off_t)sizeof(user_data));
+	assert(pread(fd, read_back, sizeof(read_back), 0) == (ssize_t)sizeof(read_back));
+	assert(memcmp(read_back, user_data, sizeof(user_data)) == 0);
+
+	close(fd);
+	unlink(other);
+}
+
+
+// --- TESTS MONDE PARTAGÉ ---
+
+ARMEL_TEST(test_shared_world) {
+	char name[64];
+	snprintf(name, sizeof(name), "/arlecs_test_%d", (int)getpid());
+
+	// 1. L'écrivain crée le monde dans le segment, rien n'est visible avant la publication
+	ArlSharedWorld sw;
+	assert(arlecs_shared_create(&sw, name, 1024 * 1024, 1000));
+	ArlEcsWorld* world = sw.world;
+
+	// Un second écrivain sur le même nom est refusé, le segment n'est pas touché
+	ArlSharedWorld intruder;
+	assert(! arlecs_shared_create(&intruder, name, 64 * 1024, 10));
+	assert(sw.header->size == sw.size && sw.header->seq == 1 && world->max_entities == 1000);
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new_hashed(world, Vel, 16);
+	uint32_t RES_TICK = arlecs_resource_new(world, uint32_t);
+
+	for (int i = 0; i < 100; i++) {
+		ArlEntity e = arlecs_create_entity(world);
+		Pos_add(world, e, COMP_POS)->x = (float)i;
+		if (i % 10 == 0) Vel_add(world, e, COMP_VEL)->vx = (float)i;
+	}
+	*arlecs_resource_get(world, RES_TICK, uint32_t) = 7;
+
+	Armel local;
+	arl_new(&local, 1024 * 1024);
+	ArlSharedReader reader;
+	assert(arlecs_shared_attach(&reader, name, &local));
+	assert((void*)reader.header != (void*)sw.header); // Autre adresse : les en-têtes sont recalés
+	assert(arlecs_shared_read_begin(&reader) == NULL);
+
+	arlecs_shared_publish(&sw);
+
+	// 2. Le lecteur parcourt les pools en place, avec les vues et getters habituels
+	ArlEcsWorld* view_world = arlecs_shared_read_begin(&reader);
+	assert(view_world && reader.frame == 1);
+	assert((const uint8_t*)view_world->pools[COMP_POS]->data > (const uint8_t*)reader.header);
+	assert((const uint8_t*)view_world->pools[COMP_POS]->data < (const uint8_t*)reader.header + reader.size);
+
+	uint32_t count = 0;
+	ArlView view = arlecs_view(view_world, 2, COMP_VEL, COMP_POS);
+	while (arlecs_view_next(&view)) {
+		assert(((Vel*)view.components[0])->vx == (float)view.entity);
+		assert(((Pos*)view.components[1])->x == (float)view.entity);
+		count++;
+	}
+	assert(count == 10);
+	assert(Pos_get(view_world, 42, COMP_POS)->x == 42.0f && Vel_get(view_world, 42, COMP_VEL) == NULL);
+	assert(*arlecs_resource_get(view_world, RES_TICK, uint32_t) == 7);
+	assert(arlecs_shared_read_end(&reader));
+
+	// 3. Lecture déchirée : l'écrivain publie pendant la lecture, sans attendre
+	assert(arlecs_shared_read_begin(&reader));
+	arlecs_shared_begin(&sw);
+	assert(arlecs_shared_read_begin(&reader) == NULL);
+	Pos_get(world, 42, COMP_POS)->x = -1.0f;
+	arlecs_remove_component(world, 50, COMP_VEL);
+	arlecs_shared_publish(&sw);
+	assert(! arlecs_shared_read_end(&reader));
+
+	// 4. Nouvelle lecture : les changements de la frame sont visibles
+	view_world = arlecs_shared_read_begin(&reader);
+	assert(view_world && reader.frame == 2);
+	assert(Pos_get(view_world, 42, COMP_POS)->x == -1.0f && Vel_get(view_world, 50, COMP_VEL) == NULL);
+	assert(arlecs_pool_size(view_world->pools[COMP_VEL]) == 9);
+	assert(arlecs_shared_read_end(&reader));
+
+	// 5. Segment inconnu ou détruit : refusé
+	ArlSharedReader missing;
+	assert(! arlecs_shared_attach(&missing, "/arlecs_test_missing", &local));
+
+	arlecs_shared_detach(&reader);
+	arlecs_shared_destroy(&sw);
+	assert(! arlecs_shared_attach(&reader, name, &local));
+	arl_free(&local);
+}
+
+
+// --- TESTS CHARGEMENT EN FLUX ---
+
+ARMEL_TEST(test_stream_loader) {
+	Armel arena;
+	arl_new(&arena, 16 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 10000);
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	// 1. Flux : 1000 entités (Pos, Vel) puis 500 entités (Pos)
+	FILE* file = tmpfile();
+	assert(file != NULL);
+	assert(arlecs_loader_write_header(file, 1500));
+
+	static Pos pos[1000];
+	static Vel vel[1000];
+	for (int i = 0; i < 1000; i++) {
+		pos[i] = (Pos){ (float)i, 0.0f };
+		vel[i] = (Vel){ 1.0f, (float)i };
+	}
+
+	uint32_t ids[2]   = { COMP_POS, COMP_VEL };
+	uint32_t sizes[2] = { sizeof(Pos), sizeof(Vel) };
+	const void* both[2] = { pos, vel };
+	assert(arlecs_loader_write_chunk(file, 1000, 2, ids, sizes, both));
+	assert(arlecs_loader_write_chunk(file, 500, 1, ids, sizes, both));
+	rewind(file);
+
+	// 2. Chargement par tranches de 300 entités maximum
+	ArlStreamLoader loader;
+	assert(arlecs_loader_open(&loader, world, file, 64 * 1024, &arena));
+
+	ArlLoadStatus status = ARL_LOAD_PENDING;
+	uint64_t previous = 0;
+	int steps = 0;
+	while (status == ARL_LOAD_PENDING) {
+		status = arlecs_loader_step(&loader, 300, 0);
+		assert(loader.loaded - previous <= 300);
+		previous = loader.loaded;
+		if (++steps % 64 == 0) usleep(100); // Laisse le lecteur avancer
+	}
+	arlecs_loader_close(&loader);
+
+	assert(status == ARL_LOAD_DONE && arlecs_loader_progress(&loader) == 1.0f);
+	assert(world->entity_counter == 1500 && steps >= 5);
+
+	for (ArlEntity e = 0; e < 1000; e++) {
+		assert(Pos_get(world, e, COMP_POS)->x == (float)e);
+		assert(Vel_get(world, e, COMP_VEL)->vy == (float)e);
+	}
+	for (ArlEntity e = 1000; e < 1500; e++) {
+		assert(Pos_get(world, e, COMP_POS)->x == (float)(e - 1000));
+		assert(Vel_get(world, e, COMP_VEL) == NULL);
+	}
+
+	// 3. Composant inconnu : erreur, rien n'est inséré
+	fclose(file);
+	file = tmpfile();
+	assert(arlecs_loader_write_header(file, 10));
+	uint32_t bad_ids[1] = { 31 };
+	assert(arlecs_loader_write_chunk(file, 10, 1, bad_ids, sizes, both));
+	rewind(file);
+
+	assert(arlecs_loader_open(&loader, world, file, 64 * 1024, &arena));
+	do {
+		status = arlecs_loader_step(&loader, 0, 1000);
+	} while (status == ARL_LOAD_PENDING);
+	arlecs_loader_close(&loader);
+	assert(status == ARL_LOAD_ERROR && world->entity_counter == 1500);
+
+	// 4. Chunk refusé en entier avant toute écriture : colonne en double, pool trop petit, puis pool haché
+	ArlPoolDesc small = { sizeof(Health), ARLECS_POOL_DEFAULT, 0.0f, 0, 4 };
+	COMP_HEALTH = arlecs_register_component_desc(world, &small);
+	uint32_t COMP_RARE = arlecs_component_new_hashed(world, Health, 64);
+	static Health health[10];
+
+	uint32_t dup_ids[2]   = { COMP_POS, COMP_POS };
+	uint32_t dup_sizes[2] = { sizeof(Pos), sizeof(Pos) };
+	const void* dup_cols[2] = { pos, pos };
+	uint32_t full_ids[2]   = { COMP_POS, COMP_HEALTH };
+	uint32_t full_sizes[2] = { sizeof(Pos), sizeof(Health) };
+	const void* full_cols[2] = { pos, health };
+	uint32_t hashed_ids[2] = { COMP_POS, COMP_RARE };
+
+	for (int bad = 0; bad < 3; bad++) {
+		fclose(file);
+		file = tmpfile();
+		assert(arlecs_loader_write_header(file, 10));
+		if (bad == 0) assert(arlecs_loader_write_chunk(file, 10, 2, dup_ids, dup_sizes, dup_cols));
+		else if (bad == 1) assert(arlecs_loader_write_chunk(file, 10, 2, full_ids, full_sizes, full_cols));
+		else assert(arlecs_loader_write_chunk(file, 10, 2, hashed_ids, full_sizes, full_cols));
+		rewind(file);
+
+		assert(arlecs_loader_open(&loader, world, file, 64 * 1024, &arena));
+		do {
+			status = arlecs_loader_step(&loader, 3, 0);
+		} while (status == ARL_LOAD_PENDING);
+		arlecs_loader_close(&loader);
+
+		assert(status == ARL_LOAD_ERROR && world->entity_counter == 1500);
+		assert(world->pools[COMP_POS]->count == 1500 && world->pools[COMP_HEALTH]->count == 0);
+		assert(world->pools[COMP_RARE]->count == 0);
+	}
+
+	// 5. En-tête invalide : close() reste sûr
+	fclose(file);
+	file = tmpfile();
+	assert(! arlecs_loader_open(&loader, world, file, 64 * 1024, &arena));
+	arlecs_loader_close(&loader);
+
+	fclose(file);
+	arl_free(&arena);
+}
+
+
+// --- TESTS ENTITES TRANSITOIRES ---
+
+ARMEL_TEST(test_transient_entities) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 1000);
+	arlecs_world_reserve_transients(world, 100);
+
+	ArlPoolDesc desc = { sizeof(Pos), ARLECS_POOL_BITSET, 0.0f, 0, 0 };
+	COMP_POS = arlecs_register_component_desc(world, &desc);
+	COMP_VEL = arlecs_component_new(world, Vel);
+	ArlPool* pool = world->pools[COMP_POS];
+
+	for (int i = 0; i < 10; i++) Pos_add(world, arlecs_create_entity(world), COMP_POS)->x = (float)i;
+
+	// 1. Frame : 20 transitoires, puis un ajout et un retrait persistants au milieu
+	ArlEntity particles[20];
+	for (int i = 0; i < 20; i++) {
+		particles[i] = arlecs_create_transient(world);
+		assert(arlecs_is_transient(world, particles[i]) && particles[i] == 900 + (ArlEntity)i);
+		Pos_add(world, particles[i], COMP_POS)->x = -1.0f;
+		if (i % 2) Vel_add(world, particles[i], COMP_VEL)->vx = 1.0f;
+	}
+	assert(pool->count == 30 && pool->transient_count == 20);
+
+	ArlEntity late = arlecs_create_entity(world);
+	Pos_add(world, late, COMP_POS)->x = (float)late;
+	arlecs_remove_component(world, 3, COMP_POS);
+	arlecs_remove_component(world, particles[5], COMP_POS);
+
+	// Les persistants restent devant, les transitoires derrière
+	assert(pool->count == 29 && pool->transient_count == 19);
+	for (uint32_t i = 0; i < pool->count; i++) {
+		bool transient = arlecs_is_transient(world, pool->dense[i]);
+		assert(transient == (i >= pool->count - pool->transient_count));
+		assert(arlecs_pool_index(pool, pool->dense[i]) == i);
+		assert(((Pos*)pool->data)[i].x == (transient ? -1.0f : (float)pool->dense[i]));
+	}
+
+	// Les vues voient les deux
+	uint32_t seen = 0;
+	ArlView view = arlecs_view(world, 2, COMP_VEL, COMP_POS);
+	while (arlecs_view_next(&view)) seen++;
+	assert(seen == 9);
+
+	// 2. Fin de frame : tout part d'un coup, sans toucher au sparse
+	uint64_t adds = pool->adds;
+	arlecs_expire_transients(world);
+	assert(pool->count == 10 && pool->transient_count == 0 && pool->adds == adds);
+	assert(world->pools[COMP_VEL]->count == 0);
+	assert(arlecs_sparse_load(pool, particles[0]) != pool->sparse_mask); // Entrée périmée...
+	assert(Pos_get(world, particles[0], COMP_POS) == NULL);             // ... mais rejetée
+	assert(pool->bits[900 >> 6] == 0 && ! (pool->bits_top[0] & ((uint64_t)1 << (900 >> 6))));
+
+	// 3. Frame suivante : les mêmes IDs repartent de zéro
+	ArlEntity again = arlecs_create_transient(world);
+	assert(again == particles[0] && Pos_get(world, again, COMP_POS) == NULL);
+	Pos* p = Pos_add(world, again, COMP_POS);
+	p->x = 42.0f;
+	assert(pool->count == 11 && Pos_get(world, again, COMP_POS) == p);
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS PREFABS ---
+
+static void spread_prefab(ArlEcsWorld* world, ArlEntity first, uint32_t n, void* const* columns, void* ctx) {
+	(void)world; (void)ctx;
+	Pos* pos = (Pos*)columns[0];
+	for (uint32_t i = 0; i < n; i++) pos[i].x = (float)(first + i);
+}
+
+ARMEL_TEST(test_prefab_instantiate) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 10000);
+	arlecs_world_reserve_transients(world, 100);
+
+	COMP_POS = arlecs_component_new(world, Pos);
+	COMP_VEL = arlecs_component_new(world, Vel);
+
+	Armel assets;
+	arl_new(&assets, 64 * 1024);
+	ArlPrefab asteroid;
+	arlecs_prefab_init(&asteroid, &assets);
+	((Pos*)arlecs_prefab_add(world, &asteroid, COMP_POS))->y = 5.0f;
+	((Vel*)arlecs_prefab_add(world, &asteroid, COMP_VEL))->vx = 2.0f;
+	assert(arlecs_prefab_add(world, &asteroid, COMP_POS) == asteroid.values[0] && asteroid.count == 2);
+
+	// Quelques transitoires déjà en fin de pool : ils doivent y rester
+	for (int i = 0; i < 3; i++) Pos_add(world, arlecs_create_transient(world), COMP_POS)->x = -1.0f;
+	Pos_add(world, arlecs_create_entity(world), COMP_POS)->x = 0.0f;
+
+	// 1. Instanciation brute : 1000 copies, IDs consécutifs
+	ArlEntity ids[1000];
+	ArlEntity first = arlecs_instantiate(world, &asteroid, 1000, ids);
+	assert(first == 1 && ids[999] == 1000 && world->entity_counter == 1001);
+
+	ArlPool* pos = world->pools[COMP_POS];
+	assert(pos->count == 1004 && pos->transient_count == 3);
+	for (ArlEntity e = 1; e <= 1000; e++) {
+		assert(Pos_get(world, e, COMP_POS)->y == 5.0f && Vel_get(world, e, COMP_VEL)->vx == 2.0f);
+	}
+	for (uint32_t i = pos->count - 3; i < pos->count; i++) {
+		assert(arlecs_is_transient(world, pos->dense[i]) && ((Pos*)pos->data)[i].x == -1.0f);
+		assert(arlecs_pool_index(pos, pos->dense[i]) == i);
+	}
+
+	// 2. Avec personnalisation par colonnes contiguës
+	first = arlecs_instantiate_ex(world, &asteroid, 37, NULL, spread_prefab, NULL);
+	assert(first == 1001);
+	for (ArlEntity e = 1001; e < 1038; e++) {
+		Pos* p = Pos_get(world, e, COMP_POS);
+		assert(p->x == (float)e && p->y == 5.0f);
+	}
+
+	// Le modèle n'a pas bougé, les transitoires expirent normalement
+	assert(((Pos*)asteroid.values[0])->x == 0.0f);
+	arlecs_expire_transients(world);
+	assert(pos->count == 1038 && Pos_get(world, 1037, COMP_POS)->x == 1037.0f);
+
+	// Pool plus petit que le monde : refus avant toute écriture, y compris dans Pos
+	ArlPoolDesc small = { sizeof(Health), ARLECS_POOL_DEFAULT, 0.0f, 0, 40 };
+	COMP_HEALTH = arlecs_register_component_desc(world, &small);
+	ArlPrefab guard;
+	arlecs_prefab_init(&guard, &assets);
+	arlecs_prefab_add(world, &guard, COMP_POS);
+	((Health*)arlecs_prefab_add(world, &guard, COMP_HEALTH))->hp = 9;
+
+	assert(arlecs_instantiate(world, &guard, 41, NULL) == ARL_NULL_ENTITY);
+	assert(world->entity_counter == 1038 && pos->count == 1038 && world->pools[COMP_HEALTH]->count == 0);
+	first = arlecs_instantiate(world, &guard, 40, NULL);
+	assert(first == 1038 && ((Health*)arlecs_get_component(world, 1077, COMP_HEALTH))->hp == 9);
+
+	// 3. Modèle créé après un snapshot : la restauration ne le touche pas
+	Armel saves;
+	arl_new(&saves, 1024 * 1024);
+	ArlEcsWorld* saved = arlecs_world_clone_into(world, &saves);
+	ArlPrefab late;
+	arlecs_prefab_init(&late, &assets);
+	((Vel*)arlecs_prefab_add(world, &late, COMP_VEL))->vy = 7.0f;
+
+	arlecs_world_restore(world, saved);
+	uint32_t COMP_EXTRA = arlecs_register_component(world, 64); // Réutilise la fin de l'arène du monde
+	memset(world->pools[COMP_EXTRA]->data, 0xAB, 64);
+	assert(((Vel*)late.values[0])->vy == 7.0f && ((Vel*)late.values[0])->vx == 0.0f);
+	arl_free(&saves);
+	arl_free(&assets);
+
+	arl_free(&arena);
+}
+
+
+// --- TESTS SPATIAL ---
+
+// Comptage brut, pour vérifier les requêtes
+static uint32_t brute_radius(ArlEcsWorld* world, float cx, float cy, float r) {
+	uint32_t n = 0;
+	for (ArlEntity e = 0; e < world->entity_counter; e++) {
+		Pos* p = Pos_get(world, e, COMP_POS);
+		if (p && (p->x - cx) * (p->x - cx) + (p->y - cy) * (p->y - cy) <= r * r) n++;
+	}
+	return n;
+}
+
+ARMEL_TEST(test_spatial_grid) {
+	Armel arena;
+	arl_new(&arena, 4 * 1024 * 1024);
+	ArlEcsWorld* world = arlecs_world_create(&arena, 5000);
+	COMP_POS = arlecs_component_new(world, Pos);
+
+	for (int i = 0; i < 4096; i++) {
+		Pos* p = Pos_add(world, arlecs_create_entity(world), COMP_POS);
+		p->x = (float)((i * 37) % 100);
+		p->y = (float)((i * 91) % 100);
+	}
+
+	float min[2] = { 0, 0 }, max[2] = { 100, 100 };
+	ArlSpatialGrid* grid = arlecs_spatial_create(world, COMP_POS, 2, min, max, 10.0f);
+	arlecs_spatial_rebuild(grid);
+	assert(grid->count == 4096);
+
+	ArlEntity found[4096];
+	float c[2] = { 42, 17 };
+	assert(arlecs_spatial_query_radius(grid, c, 12.0f, found, 4096) == brute_radius(world, 42, 17, 12));
+
+	// Même tri en parallèle, sur des workers persistants et de la mémoire temporaire
+	ArlEntity sequential[4096];
+	memcpy(sequential, grid->entities, sizeof(sequential));
+
+	Armel scratch;
+	arl_new(&scratch, 1024 * 1024);
+	ArlWorkerPool workers;
+	assert(arlecs_workers_start(&workers, 4, NULL) == 4);
+	uintptr_t world_mark = arl_offset(&arena);
+
+	for (int round = 0; round < 3; round++) {
+		arlecs_spatial_rebuild_parallel(grid, &workers, &scratch);
+		assert(memcmp(sequential, grid->entities, sizeof(sequential)) == 0);
+	}
+	assert(arl_offset(&arena) == world_mark && arl_offset(&scratch) == 0);
+	arlecs_workers_stop(&workers);
+	arl_free(&scratch);
+
+	// Déplacement, ajout et retrait incrémentaux
+	Pos_get(world, 5, COMP_POS)->x = 99.0f;
+	Pos_get(world, 6, COMP_POS)->y = 1.0f;
+	arlecs_remove_component(world, 7, COMP_POS);
+	ArlEntity fresh = arlecs_create_entity(world);
+	Pos* p = Pos_add(world, fresh, COMP_POS);
+	p->x = 42; p->y = 17;
+
+	ArlEntity changed[4] = { 5, 6, 7, fresh };
+	arlecs_spatial_update(grid, changed, 4);
+	assert(grid->count == 4096);
+	assert(grid->entity_cell[7] == ARL_NULL_ID);
+
+	// Partie triée (trous compris) puis queue : chaque entité sait où elle est
+	for (uint32_t cell = 0; cell < grid->cell_count; cell++) {
+		for (uint32_t i = grid->cell_start[cell]; i < grid->cell_start[cell + 1]; i++) {
+			if (grid->entities[i] == ARL_NULL_ENTITY) continue; // Trou
+			assert(grid->entity_cell[grid->entities[i]] == cell);
+			assert(grid->entity_slot[grid->entities[i]] == i);
+		}
+	}
+	for (uint32_t i = grid->cell_start[grid->cell_count]; i < grid->end; i++) {
+		assert(grid->entity_slot[grid->entities[i]] == i);
+	}
+	assert(grid->holes >= 2 && grid->end == grid->count + grid->holes); // 5 et 7 au moins ont laissé un trou
+	assert(arlecs_spatial_query_radius(grid, c, 12.0f, found, 4096) == brute_radius(world, 42, 17, 12));
+
+	// Boîte : un span par ligne de la grille, plus la queue ; le retour est le total, comme query_radius
+	ArlSpatialSpan spans[16];
+	float bmin[2] = { 0, 0 }, bmax[2] = { 15, 25 };
+	uint32_t n = arlecs_spatial_query_aabb(grid, bmin, bmax, spans, 16);
+	assert(n == 4);
+	uint32_t total = 0;
+	for (uint32_t s = 0; s < n; s++) total += spans[s].count;
+	assert(total > 0 && total <= grid->end);
+	assert(arlecs_spatial_query_aabb(grid, bmin, bmax, spans, 2) == 4);
+
+	// Beaucoup de déplacements : coût O(1) chacun, reconstruction quand la dette dépasse le seuil
+	ArlEntity moved[256];
+	for (uint32_t k = 0; k < 256; k++) {
+		moved[k] = (ArlEntity)(k * 13);
+		Pos* q = Pos_get(world, moved[k], COMP_POS);
+		if (q) q->x = (float)((k * 7) % 100);
+	}
+	for (uint32_t k = 0; k < 256; k += 32) arlecs_spatial_update(grid, moved + k, 32);
+	assert(grid->holes + (grid->end - grid->cell_start[grid->cell_count]) <= grid->count / 8 + ARLECS_SPATIAL_SLACK_MIN);
+	assert(grid->count == 4096);
+	assert(arlecs_spatial_query_radius(grid, c, 12.0f, found, 4096) == brute_radius(world, 42, 17, 12));
+	// Dette trop grande : une seule reconstruction, la grille repart compacte
+	static ArlEntity all[4096];
+	for (uint32_t k = 0; k < 4096; k++) {
+		all[k] = (ArlEntity)k;
+		Pos* q = Pos_get(world, all[k], COMP_POS);
+		if (q) q->y = (float)((k * 53) % 100);
+	}
+	arlecs_spatial_update(grid, all, 4096);
+	assert(grid->holes == 0 && grid->end == grid->count && grid->cell_start[grid->cell_count] == grid->count);
+
+	float far[2] = { 90, 90 };
+	assert(arlecs_spatial_query_radius(grid, far, 30.0f, found, 4096) == brute_radius(world, 90, 90, 30));
+
+	arl_free(&arena);
+}
 
 
 // --- MAIN ---
@@ -279,6 +2031,32 @@ int main() {
 	RUN_TEST(test_components_data);
 	RUN_TEST(test_view_filtering);
 	RUN_TEST(test_view_removal_safety);
+	RUN_TEST(test_typed_view);
+	RUN_TEST(test_many_components_mask);
+	RUN_TEST(test_world_stats);
+	RUN_TEST(test_snapshot_restore);
+	RUN_TEST(test_world_delta);
+	RUN_TEST(test_shards_migrate);
+	RUN_TEST(test_concurrent_spawn);
+
+	RUN_TEST(test_system_scratch);
+	RUN_TEST(test_system_interval_budget);
+	RUN_TEST(test_world_resources);
+	RUN_TEST(test_spatial_grid);
+	RUN_TEST(test_stable_pool);
+	RUN_TEST(test_bitset_view);
+	RUN_TEST(test_index16_pool);
+	RUN_TEST(test_persistent_world);
+	RUN_TEST(test_stream_loader);
+	RUN_TEST(test_aligned_pool);
+	RUN_TEST(test_bulk_removal);
+	RUN_TEST(test_transient_entities);
+	RUN_TEST(test_prefab_instantiate);
+	RUN_TEST(test_system_input_skips);
+	RUN_TEST(test_hashed_pool);
+	RUN_TEST(test_memory_hints);
+	RUN_TEST(test_view_prefetch);
+	RUN_TEST(test_shared_world);
 
 	printf("\n🎉 All tests passed successfully!\n");
 	return 0;